@@ -1,8 +1,21 @@
 #include <convertible/convertible.hxx>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
 #include <optional>
+#include <span>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <doctest/doctest.h>
@@ -14,6 +27,46 @@ namespace bench = ankerl::nanobench;
 
 namespace
 {
+  // incremented by the replaced global operator new (below)
+  std::atomic<std::size_t> allocations = 0; // NOLINT
+}
+
+// NOTE: kept out-of-line, or GCC will warn about 'free' not matching 'operator new' once inlined.
+[[gnu::noinline]] auto
+operator new(std::size_t size) -> void*
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto* ptr = std::malloc(size == 0 ? 1 : size)) // NOLINT
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr); // NOLINT
+}
+
+[[gnu::noinline]] void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr); // NOLINT
+}
+
+namespace
+{
+  // Number of heap allocations made by a single invocation of 'fn'.
+  template<typename fn_t>
+  auto
+  count_allocations(fn_t&& fn) -> std::size_t
+  {
+    auto const before = allocations.load();
+    fn();
+    return allocations.load() - before;
+  }
+
   auto
   gen_random_int()
   {
@@ -68,6 +121,21 @@ namespace
     }
   };
 
+  struct double_string_converter
+  {
+    auto
+    operator()(std::string const& s) const -> double
+    {
+      return std::stod(s);
+    }
+
+    auto
+    operator()(double d) const -> std::string
+    {
+      return std::to_string(d);
+    }
+  };
+
   auto
   create_type_a()
   {
@@ -99,6 +167,354 @@ namespace
 
     return obj;
   }
+
+  template<typename from_t, typename to_t>
+  void
+  bench_numeric_conversion(bench::Bench& b, char const* title)
+  {
+    constexpr std::size_t size = 10000;
+
+    auto from = std::vector<from_t>(size);
+    auto to   = std::vector<to_t>(size);
+    for (auto& val : from)
+    {
+      val = static_cast<from_t>(gen_random_int() % 1000);
+    }
+
+    b.title(title)
+      .run("convertible",
+           [&]
+           {
+             operators::assign{}(to, from);
+             bench::doNotOptimizeAway(to);
+           })
+      .run("scalar loop",
+           [&]
+           {
+             to.resize(from.size());
+             for (std::size_t i = 0; i < from.size(); ++i)
+             {
+               to[i] = static_cast<to_t>(from[i]);
+             }
+             bench::doNotOptimizeAway(to);
+           });
+  }
+
+  template<typename lhs_t, typename rhs_t>
+  void
+  bench_sequence_equal(bench::Bench& b, char const* title)
+  {
+    constexpr std::size_t size = 10000;
+
+    auto lhs = std::vector<lhs_t>(size);
+    auto rhs = std::vector<rhs_t>(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      lhs[i] = static_cast<lhs_t>(gen_random_int() % 1000);
+      rhs[i] = static_cast<rhs_t>(lhs[i]);
+    }
+
+    b.title(title)
+      .run("convertible",
+           [&]
+           {
+             auto equal = operators::equal{}(lhs, rhs);
+             bench::doNotOptimizeAway(equal);
+           })
+      .run("scalar loop",
+           [&]
+           {
+             auto equal = std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+                                     [](auto l, auto r) { return l == r; });
+             bench::doNotOptimizeAway(equal);
+           });
+  }
+
+  template<typename to_t, typename from_t>
+  void
+  bench_associative_update(bench::Bench& b, char const* title)
+  {
+    constexpr std::size_t size = 10000;
+
+    auto from = from_t{};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      from.emplace("key_" + gen_random_str(16), static_cast<int>(i));
+    }
+    auto to = to_t{};
+    operators::assign{}(to, from, int_string_converter{});
+
+    // previous behavior: clear 'to' & re-insert every key
+    auto const reinsert = [&]
+    {
+      to.clear();
+      for (auto const& [key, value] : from)
+      {
+        to.emplace(key, int_string_converter{}(value));
+      }
+      bench::doNotOptimizeAway(to);
+    };
+    auto const update = [&]
+    {
+      operators::assign{}(to, from, int_string_converter{});
+      bench::doNotOptimizeAway(to);
+    };
+
+    std::printf("%s (same keys), allocations/op: clear + re-insert = %zu, convertible = %zu\n",
+                title, count_allocations(reinsert), count_allocations(update));
+
+    // every other update replaces 10% of the keys
+    auto changed = from;
+    for (std::size_t i = 0; i < size / 10; ++i)
+    {
+      changed.erase(changed.begin());
+      changed.emplace("key_" + gen_random_str(16), static_cast<int>(i));
+    }
+    auto updateChanged = [&, toggle = false]() mutable
+    {
+      operators::assign{}(to, (toggle = !toggle) ? changed : from, int_string_converter{});
+      bench::doNotOptimizeAway(to);
+    };
+
+    std::printf("%s (10%% keys changed), allocations/op: convertible = %zu\n", title,
+                count_allocations(updateChanged));
+
+    b.title(title)
+      .run("convertible", update)
+      .run("convertible (10% keys changed)", updateChanged)
+      .run("clear + re-insert", reinsert);
+  }
+
+  template<typename to_t, typename from_t>
+  void
+  bench_associative_insertion(bench::Bench& b, char const* title, std::size_t size)
+  {
+    auto from = from_t{};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      from.emplace(gen_random_int(), static_cast<int>(i));
+    }
+    auto to = to_t{};
+
+    b.title(std::string(title) + " (" + std::to_string(size) + " keys)")
+      .run("convertible",
+           [&]
+           {
+             to.clear();
+             operators::assign{}(to, from);
+             bench::doNotOptimizeAway(to);
+           })
+      .run("insert (begin hint)",
+           [&]
+           {
+             // previous behavior: a new insert_iterator (hinted with begin) per key
+             to.clear();
+             for (auto const& elem : from)
+             {
+               std::insert_iterator(to, std::begin(to)) = elem;
+             }
+             bench::doNotOptimizeAway(to);
+           });
+  }
+
+  template<typename lhs_t, typename rhs_t>
+  void
+  bench_associative_equal(bench::Bench& b, char const* title)
+  {
+    constexpr std::size_t size = 100000;
+
+    auto lhs = lhs_t{};
+    auto rhs = rhs_t{};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      auto const key = gen_random_int();
+      lhs.emplace(key, static_cast<int>(i));
+      rhs.emplace(key, static_cast<int>(i));
+    }
+
+    b.title(title)
+      .run("convertible",
+           [&]
+           {
+             auto equal = operators::equal{}(lhs, rhs);
+             bench::doNotOptimizeAway(equal);
+           })
+      .run("contains + 2 lookups",
+           [&]
+           {
+             // previous behavior
+             auto equal = std::all_of(std::begin(lhs), std::end(lhs),
+                                      [&](auto const& elem)
+                                      {
+                                        return rhs.contains(elem.first) &&
+                                               lhs.at(elem.first) == rhs.at(elem.first);
+                                      });
+             bench::doNotOptimizeAway(equal);
+           });
+  }
+
+  template<typename number_t, typename baseline_converter_t>
+  void
+  bench_numeric_string(bench::Bench& b, char const* type)
+  {
+    constexpr std::size_t size = 10000;
+
+    auto nums = std::vector<number_t>(size);
+    auto strs = std::vector<std::string>(size);
+    for (auto& num : nums)
+    {
+      num = static_cast<number_t>(gen_random_int()) / static_cast<number_t>(7);
+    }
+
+    auto const converter = converter::numeric_string<number_t>{};
+    auto const baseline  = baseline_converter_t{};
+
+    b.title(std::string("vector<") + type + "> -> vector<string>")
+      .run("numeric_string",
+           [&]
+           {
+             operators::assign{}(strs, nums, converter);
+             bench::doNotOptimizeAway(strs);
+           })
+      .run("std::to_string",
+           [&]
+           {
+             operators::assign{}(strs, nums, baseline);
+             bench::doNotOptimizeAway(strs);
+           });
+
+    b.title(std::string("vector<string> -> vector<") + type + ">")
+      .run("numeric_string",
+           [&]
+           {
+             operators::assign{}(nums, strs, converter);
+             bench::doNotOptimizeAway(nums);
+           })
+      .run("std::sto*",
+           [&]
+           {
+             operators::assign{}(nums, strs, baseline);
+             bench::doNotOptimizeAway(nums);
+           });
+  }
+
+  // one mapping per element of an array of vectors
+  template<std::size_t... is>
+  auto
+  make_indexed_table(std::index_sequence<is...>)
+  {
+    return mapping_table{mapping(index<is>(), index<is>(), converter::numeric_string<int>{})...};
+  }
+
+  // 'depth' optional hops down to a value
+  template<std::size_t depth>
+  struct chain
+  {
+    std::optional<chain<depth - 1>> next;
+  };
+
+  template<>
+  struct chain<0>
+  {
+    int value{};
+  };
+
+  template<std::size_t depth>
+  auto
+  make_chain(int value)
+  {
+    auto obj = chain<depth>{};
+    if constexpr (depth == 0)
+    {
+      obj.value = value;
+    }
+    else
+    {
+      obj.next = make_chain<depth - 1>(value);
+    }
+    return obj;
+  }
+
+  template<std::size_t depth>
+  auto
+  read_chain(chain<depth> const& obj, int& value) -> bool
+  {
+    if constexpr (depth == 0)
+    {
+      value = obj.value;
+      return true;
+    }
+    else
+    {
+      return obj.next && read_chain(*obj.next, value);
+    }
+  }
+
+  // reads 'chain<depth>::next->...->value', built up as 'member(ptr, deref(maybe(inner)))'
+  template<std::size_t depth>
+  auto
+  chain_reader(concepts::adapter auto&& inner)
+  {
+    if constexpr (depth == 0)
+    {
+      return member(&chain<0>::value, inner);
+    }
+    else
+    {
+      return chain_reader<depth - 1>(deref(maybe(member(&chain<depth>::next, inner))));
+    }
+  }
+
+  template<std::size_t depth>
+  auto
+  chain_reader()
+  {
+    return chain_reader<depth - 1>(deref(maybe(member(&chain<depth>::next))));
+  }
+
+  template<std::size_t depth>
+  void
+  bench_chain(bench::Bench& b)
+  {
+    struct flat
+    {
+      int value{};
+    };
+
+    auto const map = mapping(chain_reader<depth>(), member(&flat::value));
+    auto       lhs = make_chain<depth>(42);
+    auto       rhs = flat{};
+
+    b.title(std::to_string(depth) + " optionals deep")
+      .run("manual",
+           [&]
+           {
+             read_chain(lhs, rhs.value);
+             bench::doNotOptimizeAway(rhs);
+           })
+      .run("mapping",
+           [&]
+           {
+             map.template assign<direction::lhs_to_rhs>(lhs, rhs);
+             bench::doNotOptimizeAway(rhs);
+           });
+  }
+
+  struct document
+  {
+    std::vector<std::string> lines;
+    int                      revision{};
+  };
+
+  // identity, for comparing the lines of both tables alike
+  struct lines_identity : converter::identity
+  {};
+
+  // same, but claiming to be the cheapest to compare (ie. keeps the declaration order)
+  struct cheap_identity : lines_identity
+  {
+    static constexpr std::size_t equal_cost = 0;
+  };
 }
 
 TEST_CASE("mapping_table")
@@ -160,3 +576,757 @@ TEST_CASE("mapping_table")
                                             lhs.val4 == rhs.val4);
          });
 }
+
+TEST_CASE("mapping_table hashing")
+{
+  auto const table =
+    mapping_table{mapping(member(&type_a::val1), member(&type_b::val1)),
+                  mapping(member(&type_a::val2), member(&type_b::val2)),
+                  mapping(member(&type_a::val3), member(&type_b::val3), int_string_converter{}),
+                  mapping(deref(member(&type_a::val4)), member(&type_b::val4))};
+  auto const numericTable =
+    mapping_table{mapping(member(&type_a::val1), member(&type_b::val1)),
+                  mapping(member(&type_a::val2), member(&type_b::val2)),
+                  mapping(member(&type_a::val3), member(&type_b::val3),
+                          converter::numeric_string<int>{}),
+                  mapping(deref(member(&type_a::val4)), member(&type_b::val4))};
+
+  auto const rhs = create_type_b();
+  auto       lhs = create_type_a();
+  table.assign<direction::rhs_to_lhs>(lhs, rhs);
+
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  b.title("hash (1000 element members)")
+    .run("equal (reference)",
+         [&]
+         {
+           bench::doNotOptimizeAway(table.equal(lhs, rhs));
+         })
+    .run("hash_lhs",
+         [&]
+         {
+           bench::doNotOptimizeAway(table.hash_lhs(lhs));
+         })
+    .run("hash_rhs (converting)",
+         [&]
+         {
+           bench::doNotOptimizeAway(table.hash_rhs(rhs));
+         })
+    .run("hash_rhs (numeric_string)",
+         [&]
+         {
+           bench::doNotOptimizeAway(numericTable.hash_rhs(rhs));
+         });
+}
+
+TEST_CASE("mapping_table (r-value)")
+{
+  struct record_a
+  {
+    std::string                name;
+    std::vector<int>           values;
+    std::map<int, std::string> lookup;
+  };
+
+  struct record_b
+  {
+    std::string                name;
+    std::vector<int>           values;
+    std::map<int, std::string> lookup;
+  };
+
+  auto table = mapping_table{mapping(member(&record_a::name), member(&record_b::name)),
+                             mapping(member(&record_a::values), member(&record_b::values)),
+                             mapping(member(&record_a::lookup), member(&record_b::lookup))};
+
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  for (std::size_t size : {std::size_t{100}, std::size_t{10000}})
+  {
+    auto a = record_a{gen_random_str(size), std::vector<int>(size), {}};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      a.values[i] = gen_random_int();
+      a.lookup.emplace(static_cast<int>(i), gen_random_str(32));
+    }
+    auto c = a;
+
+    auto const title = "record_a <-> record_b (" + std::to_string(size) + " elements)";
+    b.title(title)
+      .run("convertible (r-value)",
+           [&]
+           {
+             // ping-pong so there is always something to move from
+             record_b tmp = table(std::move(a));
+             a            = table(std::move(tmp));
+             bench::doNotOptimizeAway(a);
+           })
+      .run("convertible (copy)",
+           [&]
+           {
+             record_b tmp = table(c);
+             c            = table(tmp);
+             bench::doNotOptimizeAway(c);
+           });
+  }
+}
+
+TEST_CASE("mapping_table batch")
+{
+  struct record_a
+  {
+    std::int32_t id;
+    float        value;
+    std::int16_t flags;
+  };
+
+  struct record_b
+  {
+    std::int32_t id;
+    double       value;
+    std::int32_t flags;
+  };
+
+  auto table = mapping_table{mapping(member(&record_a::id), member(&record_b::id)),
+                             mapping(member(&record_a::value), member(&record_b::value)),
+                             mapping(member(&record_a::flags), member(&record_b::flags))};
+
+  for (std::size_t size : {std::size_t{1000}, std::size_t{100000}, std::size_t{10000000}})
+  {
+    auto lhs = std::vector<record_a>(size);
+    auto rhs = std::vector<record_b>(size);
+    for (auto& record : lhs)
+    {
+      record = {gen_random_int(), static_cast<float>(gen_random_int()),
+                static_cast<std::int16_t>(gen_random_int())};
+    }
+
+    bench::Bench b;
+    b.warmup(size > 100000 ? 1 : 100).relative(true).batch(size).unit("record");
+
+    b.title("record_a -> record_b (" + std::to_string(size) + " records)")
+      .run("assign (loop)",
+           [&]
+           {
+             for (std::size_t i = 0; i < size; ++i)
+             {
+               table.assign<direction::lhs_to_rhs>(lhs[i], rhs[i]);
+             }
+             bench::doNotOptimizeAway(rhs);
+           })
+      .run("assign_batch (row-wise)",
+           [&]
+           {
+             table.assign_batch<direction::lhs_to_rhs, traversal::row_wise>(std::span(lhs),
+                                                                            std::span(rhs));
+             bench::doNotOptimizeAway(rhs);
+           })
+      .run("assign_batch (column-wise)",
+           [&]
+           {
+             table.assign_batch<direction::lhs_to_rhs, traversal::column_wise>(std::span(lhs),
+                                                                               std::span(rhs));
+             bench::doNotOptimizeAway(rhs);
+           });
+
+    b.title("record_a == record_b (" + std::to_string(size) + " records)")
+      .run("equal (loop)",
+           [&]
+           {
+             auto mask = std::vector<bool>(size);
+             for (std::size_t i = 0; i < size; ++i)
+             {
+               mask[i] = table.equal(lhs[i], rhs[i]);
+             }
+             bench::doNotOptimizeAway(mask);
+           })
+      .run("equal_batch (row-wise)",
+           [&]
+           {
+             auto mask = table.equal_batch<direction::rhs_to_lhs, traversal::row_wise>(
+               std::span(lhs), std::span(rhs));
+             bench::doNotOptimizeAway(mask);
+           })
+      .run("equal_batch (column-wise)",
+           [&]
+           {
+             auto mask = table.equal_batch<direction::rhs_to_lhs, traversal::column_wise>(
+               std::span(lhs), std::span(rhs));
+             bench::doNotOptimizeAway(mask);
+           });
+  }
+}
+
+TEST_CASE("parallel sequence conversion")
+{
+  auto ints = std::vector<int>(1000000);
+  for (auto& val : ints)
+  {
+    val = gen_random_int();
+  }
+  auto strings = std::vector<std::string>{};
+  auto floats  = std::vector<float>{};
+
+  auto large = std::vector<int>(10000000);
+  for (auto& val : large)
+  {
+    val = gen_random_int();
+  }
+
+  bench::Bench b;
+  b.warmup(1).relative(true);
+
+  b.title("vector<int> -> vector<string> (1M elements)");
+  for (std::size_t threads : {1, 2, 4, 8, 16})
+  {
+    auto const policy = execution::parallel_policy{.concurrency = threads};
+    b.run(std::to_string(threads) + " thread(s)",
+          [&]
+          {
+            operators::assign{}(policy, strings, ints, int_string_converter{});
+            bench::doNotOptimizeAway(strings);
+          });
+  }
+
+  b.title("vector<int> -> vector<float> (10M elements)");
+  for (std::size_t threads : {1, 2, 4, 8, 16})
+  {
+    auto const policy = execution::parallel_policy{.concurrency = threads};
+    b.run(std::to_string(threads) + " thread(s)",
+          [&]
+          {
+            operators::assign{}(policy, floats, large);
+            bench::doNotOptimizeAway(floats);
+          });
+  }
+}
+
+TEST_CASE("parallel sequence equality")
+{
+  constexpr std::size_t size = 1000000;
+
+  auto ints    = std::vector<int>(size);
+  auto strings = std::vector<std::string>(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    ints[i]    = gen_random_int();
+    strings[i] = std::to_string(ints[i]);
+  }
+  auto early        = strings;
+  early[size / 100] = std::to_string(ints[size / 100] ^ 1);
+
+  bench::Bench b;
+  b.warmup(1).relative(true);
+
+  for (auto const& [title, rhs] :
+       {std::pair{"all equal", &strings}, std::pair{"early mismatch", &early}})
+  {
+    b.title(std::string("vector<int> == vector<string> (1M elements, ") + title + ")");
+    b.run("sequential",
+          [&]
+          {
+            auto equal = operators::equal{}(ints, *rhs, int_string_converter{});
+            bench::doNotOptimizeAway(equal);
+          });
+    for (std::size_t threads : {1, 2, 4, 8, 16})
+    {
+      auto const policy = execution::parallel_policy{.concurrency = threads};
+      b.run(std::to_string(threads) + " thread(s)",
+            [&]
+            {
+              auto equal = operators::equal{}(policy, ints, *rhs, int_string_converter{});
+              bench::doNotOptimizeAway(equal);
+            });
+    }
+  }
+}
+
+TEST_CASE("sequence bulk copy")
+{
+  constexpr std::size_t size = 10000;
+
+  struct frame_a
+  {
+    std::array<int, size>   samples;
+    std::array<float, size> levels;
+  };
+
+  struct frame_b
+  {
+    std::vector<int>   samples;
+    std::vector<float> levels;
+  };
+
+  auto table = mapping_table{mapping(member(&frame_a::samples), member(&frame_b::samples)),
+                             mapping(member(&frame_a::levels), member(&frame_b::levels))};
+
+  auto lhs = std::make_unique<frame_a>();
+  auto rhs = frame_b{};
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    lhs->samples[i] = gen_random_int();
+    lhs->levels[i]  = static_cast<float>(gen_random_int());
+  }
+
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  b.title("array<int/float> -> vector<int/float>")
+    .run("convertible",
+         [&]
+         {
+           table.template assign<direction::lhs_to_rhs>(*lhs, rhs);
+           bench::doNotOptimizeAway(rhs);
+         })
+    .run("memcpy",
+         [&]
+         {
+           rhs.samples.resize(size);
+           rhs.levels.resize(size);
+           std::memcpy(rhs.samples.data(), lhs->samples.data(), size * sizeof(int));
+           std::memcpy(rhs.levels.data(), lhs->levels.data(), size * sizeof(float));
+           bench::doNotOptimizeAway(rhs);
+         });
+}
+
+TEST_CASE("sequence numeric conversion")
+{
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  bench_numeric_conversion<std::int32_t, float>(b, "vector<int32_t> -> vector<float>");
+  bench_numeric_conversion<float, std::int32_t>(b, "vector<float> -> vector<int32_t>");
+  bench_numeric_conversion<std::int32_t, double>(b, "vector<int32_t> -> vector<double>");
+  bench_numeric_conversion<double, std::int32_t>(b, "vector<double> -> vector<int32_t>");
+  bench_numeric_conversion<float, double>(b, "vector<float> -> vector<double>");
+  bench_numeric_conversion<double, float>(b, "vector<double> -> vector<float>");
+  bench_numeric_conversion<std::int16_t, std::int32_t>(b, "vector<int16_t> -> vector<int32_t>");
+  bench_numeric_conversion<std::int32_t, std::int16_t>(b, "vector<int32_t> -> vector<int16_t>");
+  bench_numeric_conversion<std::int32_t, std::int64_t>(b, "vector<int32_t> -> vector<int64_t>");
+}
+
+TEST_CASE("sequence equal")
+{
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  bench_sequence_equal<std::int32_t, std::int32_t>(b, "vector<int32_t> == vector<int32_t>");
+  bench_sequence_equal<float, float>(b, "vector<float> == vector<float>");
+  bench_sequence_equal<std::int32_t, std::int64_t>(b, "vector<int32_t> == vector<int64_t>");
+  bench_sequence_equal<std::int16_t, std::int32_t>(b, "vector<int16_t> == vector<int32_t>");
+  bench_sequence_equal<std::int32_t, float>(b, "vector<int32_t> == vector<float>");
+  bench_sequence_equal<float, double>(b, "vector<float> == vector<double>");
+}
+
+TEST_CASE("associative update")
+{
+  bench::Bench b;
+  b.warmup(10).relative(true);
+
+  bench_associative_update<std::map<std::string, std::string>, std::map<std::string, int>>(
+    b, "map<string, int> -> map<string, string>");
+  bench_associative_update<std::unordered_map<std::string, std::string>,
+                           std::unordered_map<std::string, int>>(
+    b, "unordered_map<string, int> -> unordered_map<string, string>");
+}
+
+TEST_CASE("associative insertion")
+{
+  using map_t           = std::map<int, int>;
+  using unordered_map_t = std::unordered_map<int, int>;
+
+  for (std::size_t size :
+       {std::size_t{1000}, std::size_t{10000}, std::size_t{100000}, std::size_t{1000000}})
+  {
+    bench::Bench b;
+    b.warmup(size > 10000 ? 1 : 10).relative(true).batch(size).unit("key");
+
+    bench_associative_insertion<std::map<int, long>, map_t>(b, "map -> map", size);
+    bench_associative_insertion<std::map<int, long>, unordered_map_t>(b, "unordered_map -> map",
+                                                                      size);
+    bench_associative_insertion<std::unordered_map<int, long>, map_t>(b, "map -> unordered_map",
+                                                                      size);
+  }
+}
+
+TEST_CASE("associative equal")
+{
+  bench::Bench b;
+  b.warmup(10).relative(true);
+
+  bench_associative_equal<std::map<int, long>, std::map<int, int>>(b, "map == map");
+  bench_associative_equal<std::unordered_map<int, long>, std::unordered_map<int, int>>(
+    b, "unordered_map == unordered_map");
+  bench_associative_equal<std::map<int, long>, std::unordered_map<int, int>>(
+    b, "map == unordered_map");
+}
+
+TEST_CASE("numeric string conversion")
+{
+  bench::Bench b;
+  b.warmup(10).relative(true);
+
+  bench_numeric_string<int, int_string_converter>(b, "int");
+  bench_numeric_string<double, double_string_converter>(b, "double");
+}
+
+TEST_CASE("memoized converter")
+{
+  constexpr std::size_t size = 10000;
+
+  // few distinct (but expensive to format) values, repeating heavily
+  auto nums = std::vector<double>(size);
+  auto strs = std::vector<std::string>(size);
+  for (auto& num : nums)
+  {
+    num = static_cast<double>(gen_random_int() % 50) / 3.0;
+  }
+
+  auto const converter = double_string_converter{};
+  auto const memoized  = converter::memoized<double_string_converter, 64>{};
+
+  bench::Bench b;
+  b.warmup(10).relative(true);
+
+  b.title("vector<double> -> vector<string>")
+    .run("std::to_string",
+         [&]
+         {
+           operators::assign{}(strs, nums, converter);
+           bench::doNotOptimizeAway(strs);
+         })
+    .run("memoized std::to_string",
+         [&]
+         {
+           operators::assign{}(strs, nums, memoized);
+           bench::doNotOptimizeAway(strs);
+         });
+
+  b.title("vector<string> -> vector<double>")
+    .run("std::stod",
+         [&]
+         {
+           operators::assign{}(nums, strs, converter);
+           bench::doNotOptimizeAway(nums);
+         })
+    .run("memoized std::stod",
+         [&]
+         {
+           operators::assign{}(nums, strs, memoized);
+           bench::doNotOptimizeAway(nums);
+         });
+}
+
+TEST_CASE("mapping_table incremental assign")
+{
+  constexpr std::size_t fields = 100;
+  constexpr std::size_t size   = 100;
+
+  auto const table = make_indexed_table(std::make_index_sequence<fields>{});
+
+  auto nums = std::array<std::vector<int>, fields>{};
+  auto strs = std::array<std::vector<std::string>, fields>{};
+  for (auto& field : nums)
+  {
+    field.resize(size);
+    std::generate(field.begin(), field.end(), gen_random_int);
+  }
+
+  bench::Bench b;
+  b.warmup(10).relative(true);
+
+  for (std::size_t changed : {1, 10, 100})
+  {
+    // change a different subset of the fields each tick
+    auto next   = std::size_t{0};
+    auto change = [&]
+    {
+      for (std::size_t i = 0; i < changed; ++i, next = (next + 1) % fields)
+      {
+        ++nums[next][0];
+      }
+    };
+
+    auto tracker = decltype(table)::change_tracker_t<direction::rhs_to_lhs, decltype(nums)>{};
+    table.assign_changed<direction::rhs_to_lhs>(strs, nums, tracker);
+
+    b.title(std::to_string(changed) + "% of fields changed")
+      .run("assign",
+           [&]
+           {
+             change();
+             table.assign<direction::rhs_to_lhs>(strs, nums);
+             bench::doNotOptimizeAway(strs);
+           })
+      .run("assign_changed",
+           [&]
+           {
+             change();
+             table.assign_changed<direction::rhs_to_lhs>(strs, nums, tracker);
+             bench::doNotOptimizeAway(strs);
+           });
+  }
+}
+
+TEST_CASE("mapping_table diff")
+{
+  constexpr std::size_t fields = 100;
+  constexpr std::size_t size   = 100;
+
+  auto const table = make_indexed_table(std::make_index_sequence<fields>{});
+
+  auto nums = std::array<std::vector<int>, fields>{};
+  auto strs = std::array<std::vector<std::string>, fields>{};
+  for (auto& field : nums)
+  {
+    field.resize(size);
+    std::generate(field.begin(), field.end(), gen_random_int);
+  }
+  table.assign<direction::rhs_to_lhs>(strs, nums);
+
+  bench::Bench b;
+  b.warmup(10).relative(true);
+
+  // one field changed per record
+  auto next   = std::size_t{0};
+  auto change = [&]
+  {
+    ++nums[next][0];
+    next = (next + 1) % fields;
+  };
+
+  b.title("1 of 100 fields changed")
+    .run("equal + assign",
+         [&]
+         {
+           change();
+           if (!table.equal(strs, nums))
+           {
+             table.assign<direction::rhs_to_lhs>(strs, nums);
+           }
+           bench::doNotOptimizeAway(strs);
+         })
+    .run("diff + masked assign",
+         [&]
+         {
+           change();
+           if (auto const mask = table.diff(strs, nums); mask.any())
+           {
+             table.assign_masked<direction::rhs_to_lhs>(strs, nums, mask);
+           }
+           bench::doNotOptimizeAway(strs);
+         });
+}
+
+TEST_CASE("mapping_table cost-ordered equal")
+{
+  auto const ordered = mapping_table{
+    mapping(member(&document::lines), member(&document::lines), lines_identity{}),
+    mapping(member(&document::revision), member(&document::revision))};
+  auto const declared = mapping_table{
+    mapping(member(&document::lines), member(&document::lines), cheap_identity{}),
+    mapping(member(&document::revision), member(&document::revision))};
+
+  auto lhs = document{};
+  lhs.lines.resize(1000);
+  std::generate(lhs.lines.begin(), lhs.lines.end(), [] { return gen_random_str(32); });
+  auto rhs = lhs;
+  ++rhs.revision;
+
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  b.title("only the revision differs")
+    .run("declaration order",
+         [&]
+         {
+           bench::doNotOptimizeAway(declared.equal(lhs, rhs));
+         })
+    .run("cost order",
+         [&]
+         {
+           bench::doNotOptimizeAway(ordered.equal(lhs, rhs));
+         });
+}
+
+TEST_CASE("reconcile")
+{
+  struct record_a
+  {
+    int         id{};
+    std::string name;
+    int         value{};
+  };
+
+  struct record_b
+  {
+    int         id{};
+    std::string name;
+    int         value{};
+  };
+
+  auto const key   = mapping(member(&record_a::id), member(&record_b::id));
+  auto const table = mapping_table{key, mapping(member(&record_a::name), member(&record_b::name)),
+                                   mapping(member(&record_a::value), member(&record_b::value))};
+  auto const sync  = reconciler(table, key);
+
+  bench::Bench b;
+  b.warmup(3).relative(true);
+
+  for (std::size_t size : {100, 1000, 10000})
+  {
+    // a tenth of the records inserted, updated & erased each
+    auto source = std::vector<record_b>(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      source[i] = {static_cast<int>(i), gen_random_str(16), gen_random_int()};
+    }
+    auto initial = std::vector<record_a>{};
+    sync.assign(initial, source);
+    for (std::size_t i = 0; i < size / 10; ++i)
+    {
+      initial.erase(initial.begin() + static_cast<std::ptrdiff_t>(i));
+      initial[i].value += 1;
+      initial.push_back({static_cast<int>(size + i), gen_random_str(16), gen_random_int()});
+    }
+
+    auto target = initial;
+    b.title("reconcile " + std::to_string(size) + " records")
+      .run("nested loops",
+           [&]
+           {
+             target = initial;
+             std::vector<bool> matched(target.size(), false);
+             for (auto const& rec : source)
+             {
+               auto found = false;
+               for (std::size_t j = 0; j < target.size(); ++j)
+               {
+                 if (!matched[j] && target[j].id == rec.id)
+                 {
+                   matched[j] = found = true;
+                   if (!table.equal(target[j], rec))
+                   {
+                     table.assign<direction::rhs_to_lhs>(target[j], rec);
+                   }
+                   break;
+                 }
+               }
+               if (!found)
+               {
+                 table.assign<direction::rhs_to_lhs>(target.emplace_back(), rec);
+                 matched.push_back(true);
+               }
+             }
+             std::size_t j = 0;
+             std::erase_if(target,
+                           [&](auto const&)
+                           {
+                             return !matched[j++];
+                           });
+             bench::doNotOptimizeAway(target);
+           })
+      .run("reconciler",
+           [&]
+           {
+             target = initial;
+             sync.assign(target, source);
+             bench::doNotOptimizeAway(target);
+           });
+  }
+}
+
+TEST_CASE("composed readers")
+{
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  bench_chain<4>(b);
+  bench_chain<8>(b);
+  bench_chain<16>(b);
+}
+
+TEST_CASE("mapping_table optional members")
+{
+  struct record
+  {
+    std::optional<std::string>      name;
+    std::optional<std::string>      note;
+    std::optional<std::vector<int>> values;
+    std::optional<int>              count;
+  };
+
+  auto const table = mapping_table{
+    mapping(deref(maybe(member(&record::name))), deref(maybe(member(&record::name)))),
+    mapping(deref(maybe(member(&record::note))), deref(maybe(member(&record::note)))),
+    mapping(deref(maybe(member(&record::values))), deref(maybe(member(&record::values)))),
+    mapping(deref(maybe(member(&record::count))), deref(maybe(member(&record::count))))};
+
+  // equal records, with some members empty on both sides
+  auto lhs = record{gen_random_str(64), std::nullopt, std::vector<int>(100, 1), std::nullopt};
+  auto rhs = lhs;
+
+  auto const equal = [&]
+  {
+    bench::doNotOptimizeAway(table.equal(lhs, rhs));
+  };
+  std::printf("mapping_table optional members, allocations/op: equal = %zu\n",
+              count_allocations(equal));
+
+  bench::Bench b;
+  b.warmup(100).relative(true);
+
+  b.title("equal (optional members)")
+    .run("convertible", equal)
+    .run("manual",
+         [&]
+         {
+           bench::doNotOptimizeAway(lhs.name == rhs.name && lhs.note == rhs.note &&
+                                    lhs.values == rhs.values && lhs.count == rhs.count);
+         });
+}
+
+TEST_CASE("mapping_table (compile-time members)")
+{
+  auto const table =
+    mapping_table{mapping(member(&type_a::val1), member(&type_b::val1)),
+                  mapping(member(&type_a::val2), member(&type_b::val2)),
+                  mapping(member(&type_a::val3), member(&type_b::val3), int_string_converter{}),
+                  mapping(deref(member(&type_a::val4)), member(&type_b::val4))};
+  auto const constantTable = mapping_table{
+    mapping(member<&type_a::val1>(), member<&type_b::val1>()),
+    mapping(member<&type_a::val2>(), member<&type_b::val2>()),
+    mapping(member<&type_a::val3>(), member<&type_b::val3>(), int_string_converter{}),
+    mapping(deref(member<&type_a::val4>()), member<&type_b::val4>())};
+
+  std::printf("sizeof(mapping_table): member pointers = %zu, compile-time members = %zu\n",
+              sizeof(table), sizeof(constantTable));
+
+  auto lhs = create_type_a();
+  auto rhs = create_type_b();
+
+  bench::Bench b;
+  b.warmup(500).relative(true);
+
+  b.title("equality (member pointers)")
+    .run("member pointers", [&] { bench::doNotOptimizeAway(table.equal(lhs, rhs)); })
+    .run("compile-time members", [&] { bench::doNotOptimizeAway(constantTable.equal(lhs, rhs)); });
+
+  // default adaptees are value-initialized on demand, rather than embedded in every adapter
+  b.title("copy")
+    .run("member pointers",
+         [&]
+         {
+           auto copy = table;
+           bench::doNotOptimizeAway(copy);
+         })
+    .run("compile-time members",
+         [&]
+         {
+           auto copy = constantTable;
+           bench::doNotOptimizeAway(copy);
+         });
+}
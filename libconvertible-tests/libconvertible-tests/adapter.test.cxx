@@ -223,6 +223,12 @@ SCENARIO("convertible: Adapters")
       static_assert(std::same_as<decltype(copy), typename decltype(adapter)::adaptee_value_t>);
       REQUIRE(copy == adaptee);
     }
+    THEN("without an adaptee, the default one isn't stored but value-initialized")
+    {
+      auto stateless = member(&type::str);
+      static_assert(sizeof(stateless) < sizeof(adapter));
+      REQUIRE(stateless.defaulted_adaptee() == type{});
+    }
     THEN("it works with derived types")
     {
       struct type_derived : public type
@@ -232,6 +238,39 @@ SCENARIO("convertible: Adapters")
       adapteeDerived.str = "world";
       REQUIRE(adapter(adapteeDerived) == "world");
     }
+    THEN("the member pointer can be encoded in the type")
+    {
+      auto constantAdapter = member<&type::str>(adaptee);
+      static_assert(std::is_empty_v<reader::member_constant<&type::str>>);
+      static_assert(std::is_empty_v<decltype(member<&type::str>())>);
+      static_assert(sizeof(constantAdapter) < sizeof(adapter));
+      static_assert(concepts::adaptable<decltype(adaptee), decltype(constantAdapter)>);
+      static_assert(!concepts::adaptable<invalid_type, decltype(constantAdapter)>);
+
+      REQUIRE(constantAdapter(adaptee) == "hello");
+      constantAdapter(adaptee) = "world";
+      REQUIRE(adaptee.str == "world");
+    }
+  }
+  GIVEN("member adapter with an adaptee type that isn't default constructible")
+  {
+    struct type
+    {
+      explicit type(int value)
+        : val(value)
+      {}
+
+      auto operator==(type const&) const -> bool = default;
+      int  val;
+    };
+
+    auto adapter = member(&type::val, type{3});
+
+    THEN("the given adaptee is kept as default")
+    {
+      REQUIRE(adapter.defaulted_adaptee() == type{3});
+      REQUIRE(adapter(type{4}) == 4);
+    }
   }
   GIVEN("member adapter (function)")
   {
@@ -281,6 +320,14 @@ SCENARIO("convertible: Adapters")
       adapter(adaptee) = "world";
       REQUIRE(adaptee.str() == "world");
     }
+    THEN("the member function pointer can be encoded in the type")
+    {
+      auto constantAdapter = member<&type::str>();
+      static_assert(std::is_empty_v<reader::member_constant<&type::str>>);
+
+      constantAdapter(adaptee) = "world";
+      REQUIRE(adaptee.str() == "world");
+    }
     THEN("it implicitly converts to type")
     {
       std::string val = adapter(adaptee);
@@ -632,6 +679,33 @@ SCENARIO("convertible: Adapters")
       adaptee.a.val = "";
       REQUIRE_FALSE(adapter.enabled(adaptee));
     }
+    THEN("it's checked & read in one pass, even if nested")
+    {
+      auto reads   = 0;
+      auto counted = custom(
+        [&reads](type_b& obj) -> type_a&
+        {
+          ++reads;
+          return obj.a;
+        },
+        adaptee);
+      auto nested = compose(compose(counted, maybe()), deref());
+      auto value  = std::string{};
+      auto read   = [&value](std::string const& str)
+      {
+        value = str;
+      };
+
+      REQUIRE(nested.read_if(adaptee, read));
+      REQUIRE(value == "hello");
+      REQUIRE(reads == 1);
+
+      adaptee.a.val = "";
+      value         = "unchanged";
+      REQUIRE_FALSE(nested.read_if(adaptee, read));
+      REQUIRE(value == "unchanged");
+      REQUIRE(reads == 2);
+    }
     THEN("it's constexpr constructible")
     {
       struct type_x
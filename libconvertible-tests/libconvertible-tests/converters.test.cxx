@@ -1,11 +1,35 @@
 #include <convertible/converters.hxx>
+#include <convertible/operators.hxx>
 #include <libconvertible-tests/test_common.hxx>
 
 #include <concepts>
 #include <string>
+#include <vector>
 
 #include <doctest/doctest.h>
 
+namespace
+{
+  struct counting_converter
+  {
+    int* calls = nullptr;
+
+    auto
+    operator()(int val) const -> std::string
+    {
+      ++*calls;
+      return std::to_string(val);
+    }
+
+    auto
+    operator()(std::string const& val) const -> int
+    {
+      ++*calls;
+      return std::stoi(val);
+    }
+  };
+}
+
 TEST_CASE_TEMPLATE_DEFINE("it's invocable with types", arg_tuple_t, invocable_with_types)
 {
   using converter_t = std::tuple_element_t<0, arg_tuple_t>;
@@ -59,4 +83,155 @@ SCENARIO("convertible: Converters")
       std::tuple<converter::explicit_cast<proxy<std::string const>, int_string_converter>,
                  int const&, std::string>);
   }
+
+  GIVEN("numeric_string")
+  {
+    TEST_CASE_TEMPLATE_INVOKE(invocable_with_types,
+                              std::tuple<converter::numeric_string<int>, int&, std::string>);
+    TEST_CASE_TEMPLATE_INVOKE(invocable_with_types,
+                              std::tuple<converter::numeric_string<int>, std::string&, int>);
+    TEST_CASE_TEMPLATE_INVOKE(
+      invocable_with_types,
+      std::tuple<converter::numeric_string<double>, std::string const&, double>);
+
+    auto const intConverter = converter::numeric_string<int>{};
+
+    WHEN("assigning a number to a string")
+    {
+      auto str  = std::string(32, 'x');
+      auto data = str.data();
+      intConverter.assign<direction::rhs_to_lhs>(str, -42);
+      THEN("it's assigned in place")
+      {
+        REQUIRE(str == "-42");
+        REQUIRE(str.data() == data);
+        REQUIRE(intConverter.equal<direction::rhs_to_lhs>(str, -42));
+        REQUIRE_FALSE(intConverter.equal<direction::rhs_to_lhs>(str, 42));
+      }
+    }
+    WHEN("assigning a string to a number")
+    {
+      auto num = 0;
+      intConverter.assign<direction::lhs_to_rhs>(std::string("123"), num);
+      THEN("it's parsed")
+      {
+        REQUIRE(num == 123);
+        REQUIRE(intConverter.equal<direction::lhs_to_rhs>(std::string("123"), num));
+      }
+      AND_WHEN("the string isn't a number")
+      {
+        intConverter.assign<direction::lhs_to_rhs>(std::string("abc"), num);
+        THEN("it's assigned 0")
+        {
+          REQUIRE(num == 0);
+        }
+      }
+    }
+    WHEN("assigning a vector of numbers to a vector of strings")
+    {
+      auto strs = std::vector<std::string>{};
+      intConverter.assign<direction::rhs_to_lhs>(strs, std::vector<int>{1, -2, 3});
+      THEN("all elements are assigned")
+      {
+        REQUIRE(strs == std::vector<std::string>{"1", "-2", "3"});
+
+        auto nums = std::vector<int>{};
+        intConverter.assign<direction::rhs_to_lhs>(nums, strs);
+        REQUIRE(nums == std::vector<int>{1, -2, 3});
+      }
+    }
+    WHEN("converting floating point numbers")
+    {
+      auto const floatConverter = converter::numeric_string<double>{};
+      THEN("they round-trip")
+      {
+        REQUIRE(floatConverter(0.1) == "0.1");
+        REQUIRE(floatConverter(floatConverter(1.0 / 3.0)) == 1.0 / 3.0);
+      }
+    }
+  }
+
+  GIVEN("memoized")
+  {
+    auto calls     = 0;
+    auto converter = converter::memoized<counting_converter, 4>(
+      counting_converter{&calls});
+
+    using memoized_t = converter::memoized<int_string_converter, 64>;
+    TEST_CASE_TEMPLATE_INVOKE(invocable_with_types,
+                              std::tuple<memoized_t, int&, std::string>);
+    TEST_CASE_TEMPLATE_INVOKE(invocable_with_types,
+                              std::tuple<memoized_t, std::string&&, int>);
+
+    WHEN("converting repeated values in both directions")
+    {
+      THEN("each value is converted once")
+      {
+        REQUIRE(converter(1) == "1");
+        REQUIRE(converter(1) == "1");
+        REQUIRE(converter(std::string("2")) == 2);
+        REQUIRE(converter(std::string("2")) == 2);
+        REQUIRE(calls == 2);
+      }
+    }
+    WHEN("copying it")
+    {
+      REQUIRE(converter(1) == "1");
+      auto const copy = converter;
+
+      THEN("the copy has its own cache (starting with the copied entries)")
+      {
+        REQUIRE(copy(1) == "1");
+        REQUIRE(calls == 1);
+        REQUIRE(copy(2) == "2");
+        REQUIRE(calls == 2);
+        REQUIRE(converter(2) == "2");
+        REQUIRE(calls == 3);
+      }
+    }
+    WHEN("holding on to a result while converting more values than fit")
+    {
+      auto const& first = converter(0);
+      for (int i = 1; i < 100; ++i)
+      {
+        REQUIRE(converter(i) == std::to_string(i));
+      }
+      THEN("it's unchanged")
+      {
+        REQUIRE(first == "0");
+      }
+    }
+    WHEN("converting more values than fit")
+    {
+      for (int i = 0; i < 100; ++i)
+      {
+        REQUIRE(converter(i) == std::to_string(i));
+      }
+      THEN("older values are evicted")
+      {
+        REQUIRE(calls == 100);
+        REQUIRE(converter(99) == "99");
+        REQUIRE(calls == 100);
+        REQUIRE(converter(0) == "0");
+        REQUIRE(calls == 101);
+      }
+    }
+    WHEN("assigning ranges with repeated values")
+    {
+      auto strs = std::vector<std::string>{};
+      operators::assign{}(strs, std::vector<int>{1, 2, 1, 2, 1}, converter);
+      operators::assign{}(strs, std::vector<int>{2, 1}, converter);
+      THEN("the cache persists across elements & calls")
+      {
+        REQUIRE(strs == std::vector<std::string>{"2", "1"});
+        REQUIRE(calls == 2);
+
+        auto nums = std::vector<int>{};
+        operators::assign{}(nums, strs, converter);
+        operators::assign{}(nums, strs, converter);
+        REQUIRE(nums == std::vector<int>{2, 1});
+        REQUIRE(calls == 4);
+      }
+    }
+  }
 }
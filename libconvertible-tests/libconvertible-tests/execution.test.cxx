@@ -0,0 +1,88 @@
+#include <convertible/concepts.hxx>
+#include <convertible/execution.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+using namespace convertible;
+
+namespace execution_policy
+{
+  static_assert(concepts::execution_policy<execution::sequenced_policy>);
+  static_assert(concepts::execution_policy<execution::parallel_policy const&>);
+  static_assert(!concepts::execution_policy<int>);
+}
+
+SCENARIO("convertible: Execution policies")
+{
+  GIVEN("sequenced policy")
+  {
+    auto const policy = execution::seq;
+
+    THEN("the whole range is one chunk")
+    {
+      auto chunks = std::vector<std::pair<std::size_t, std::size_t>>{};
+      policy.bulk(10,
+                  [&](std::size_t first, std::size_t last)
+                  {
+                    chunks.emplace_back(first, last);
+                  });
+      REQUIRE(chunks == std::vector<std::pair<std::size_t, std::size_t>>{
+                          {0, 10}
+      });
+    }
+  }
+
+  GIVEN("parallel policy")
+  {
+    auto const policy = execution::parallel_policy{.concurrency = 4, .min_chunk = 3};
+
+    THEN("each index is visited exactly once, in at most 'concurrency' chunks")
+    {
+      for (std::size_t count : {0, 1, 5, 12, 1001})
+      {
+        CAPTURE(count);
+        auto visits = std::vector<std::atomic<int>>(count);
+        auto calls  = std::atomic<std::size_t>{0};
+        policy.bulk(count,
+                    [&](std::size_t first, std::size_t last)
+                    {
+                      ++calls;
+                      for (auto i = first; i < last; ++i)
+                      {
+                        ++visits[i];
+                      }
+                    });
+
+        for (auto const& visit : visits)
+        {
+          REQUIRE(visit == 1);
+        }
+        // no chunk is smaller than 'min_chunk'
+        REQUIRE(calls <= std::clamp(count / 3, std::size_t{1}, std::size_t{4}));
+      }
+    }
+
+    WHEN("a chunk throws")
+    {
+      THEN("the exception is rethrown on the calling thread")
+      {
+        REQUIRE_THROWS_AS(policy.bulk(12,
+                                      [](std::size_t first, std::size_t)
+                                      {
+                                        if (first > 0)
+                                        {
+                                          throw std::runtime_error("error");
+                                        }
+                                      }),
+                          std::runtime_error);
+      }
+    }
+  }
+}
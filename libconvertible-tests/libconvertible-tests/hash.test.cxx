@@ -0,0 +1,75 @@
+#include <convertible/hash.hxx>
+
+#include <array>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+using namespace convertible;
+
+namespace hashable
+{
+  struct not_hashable
+  {};
+
+  static_assert(concepts::hashable<int>);
+  static_assert(concepts::hashable<std::string>);
+  static_assert(concepts::hashable<std::vector<int>>);
+  static_assert(concepts::hashable<std::array<std::string, 2>>);
+  static_assert(concepts::hashable<std::map<int, std::vector<std::string>>>);
+  static_assert(!concepts::hashable<not_hashable>);
+  static_assert(!concepts::hashable<std::vector<not_hashable>>);
+  static_assert(!concepts::hashable<std::map<int, not_hashable>>);
+}
+
+SCENARIO("convertible: Hash")
+{
+  GIVEN("values hashable with std::hash")
+  {
+    THEN("std::hash is used")
+    {
+      REQUIRE(hash{}(std::string("hello")) == std::hash<std::string>{}("hello"));
+    }
+  }
+  GIVEN("ranges")
+  {
+    THEN("equal ranges hash equally, regardless of type")
+    {
+      REQUIRE(hash{}(std::vector<int>{1, 2, 3}) == hash{}(std::list<int>{1, 2, 3}));
+      REQUIRE(hash{}(std::vector<int>{1, 2, 3}) == hash{}(std::array<int, 3>{1, 2, 3}));
+    }
+    THEN("order matters")
+    {
+      REQUIRE(hash{}(std::vector<int>{1, 2, 3}) != hash{}(std::vector<int>{3, 2, 1}));
+    }
+    THEN("elements of maps are hashed as key & value")
+    {
+      auto const lhs = std::map<int, std::string>{
+        {1, "a"},
+        {2, "b"}
+      };
+      auto const rhs = std::map<int, std::string>{
+        {1, "a"},
+        {2, "c"}
+      };
+      REQUIRE(hash{}(lhs) == hash{}(std::map<int, std::string>(lhs)));
+      REQUIRE(hash{}(lhs) != hash{}(rhs));
+    }
+    THEN("associative containers hash equally regardless of their order")
+    {
+      auto const lhs = std::map<int, std::string>{
+        {1, "a"},
+        {2, "b"}
+      };
+      auto const rhs = std::unordered_map<int, std::string>{
+        {2, "b"},
+        {1, "a"}
+      };
+      REQUIRE(hash{}(lhs) == hash{}(rhs));
+    }
+  }
+}
@@ -1,7 +1,9 @@
 #include <convertible/convertible.hxx>
 #include <libconvertible-tests/test_common.hxx>
 
+#include <array>
 #include <cstring>
+#include <map>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -33,6 +35,13 @@ namespace
       {
         REQUIRE(map.template equal<direction::rhs_to_lhs>(lhs, rhs));
       }
+      if constexpr (requires { map.hash_lhs(lhs) + map.hash_rhs(rhs); })
+      {
+        THEN("both hash equally")
+        {
+          REQUIRE(map.hash_lhs(lhs) == map.hash_rhs(rhs));
+        }
+      }
     }
     WHEN("assigning rhs (r-value) to lhs")
     {
@@ -166,6 +175,20 @@ SCENARIO("convertible: Mapping")
           REQUIRE_FALSE(map.template equal<direction::rhs_to_lhs>(lhs, rhs));
           REQUIRE_FALSE(map.template equal<direction::lhs_to_rhs>(lhs, rhs));
         }
+        THEN("lhs is left empty")
+        {
+          REQUIRE_FALSE(lhs.has_value());
+        }
+      }
+      WHEN("comparing lhs & rhs")
+      {
+        auto const equal = map.template equal<direction::rhs_to_lhs>(lhs, rhs);
+
+        THEN("lhs is left empty")
+        {
+          REQUIRE_FALSE(equal);
+          REQUIRE_FALSE(lhs.has_value());
+        }
       }
     }
   }
@@ -481,6 +504,36 @@ SCENARIO("convertible: Mapping (misc use-cases)")
                      }
                    });
   }
+  GIVEN("map<int, int> <-> map<double, int>")
+  {
+    using lhs_t = std::map<int, int>;
+    using rhs_t = std::map<double, int>;
+
+    auto map = mapping(identity(lhs_t{}), identity(rhs_t{}));
+
+    auto lhs = lhs_t{{1, 5}};
+    auto rhs = rhs_t{{1.0, 5}, {2.0, 6}};
+    MAPS_CORRECTLY(lhs, rhs, map,
+                   [](auto const&)
+                   {
+                     return true;
+                   });
+  }
+  GIVEN("array<int, 2> <-> vector<int>")
+  {
+    using lhs_t = std::array<int, 2>;
+    using rhs_t = std::vector<int>;
+
+    auto map = mapping(identity(lhs_t{}), identity(rhs_t{}));
+
+    auto lhs = lhs_t{};
+    auto rhs = rhs_t{1, 2, 3};
+    MAPS_CORRECTLY(lhs, rhs, map,
+                   [](auto const&)
+                   {
+                     return true;
+                   });
+  }
   GIVEN("proxy <-> string")
   {
     using lhs_t = std::string;
@@ -1,14 +1,168 @@
 #include <convertible/convertible.hxx>
 
+#include <algorithm>
+#include <array>
 #include <bitset>
+#include <cctype>
+#include <concepts>
 #include <cstddef>
+#include <functional>
+#include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <span>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <doctest/doctest.h>
 
+namespace
+{
+  struct context_t
+  {
+    std::string scratch;
+    int         conversions = 0;
+    int         reads       = 0;
+  };
+
+  struct record_a
+  {
+    int         val1{};
+    std::string val2;
+  };
+
+  struct record_b
+  {
+    std::string val1;
+    std::string val2;
+  };
+
+  // only usable with a context
+  struct contextual_formatter
+  {
+    auto
+    operator()(int val, context_t& context) const -> std::string const&
+    {
+      ++context.conversions;
+      context.scratch = std::to_string(val);
+      return context.scratch;
+    }
+
+    auto
+    operator()(std::string const& val, context_t& context) const -> int
+    {
+      ++context.conversions;
+      return std::stoi(val);
+    }
+  };
+
+  // counts reads when given a context
+  struct val1_reader
+  {
+    auto
+    operator()(auto&& obj) const -> decltype(auto)
+      requires std::same_as<std::remove_cvref_t<decltype(obj)>, record_a>
+    {
+      return (std::forward<decltype(obj)>(obj).val1);
+    }
+
+    auto
+    operator()(auto&& obj, context_t& context) const -> decltype(auto)
+      requires std::same_as<std::remove_cvref_t<decltype(obj)>, record_a>
+    {
+      ++context.reads;
+      return (std::forward<decltype(obj)>(obj).val1);
+    }
+  };
+
+  // compares strings case-insensitively, with a matching hash
+  struct case_insensitive
+  {
+    static auto
+    lower(std::string val) -> std::string
+    {
+      std::transform(val.begin(), val.end(), val.begin(),
+                     [](unsigned char c)
+                     {
+                       return static_cast<char>(std::tolower(c));
+                     });
+      return val;
+    }
+
+    auto
+    operator()(std::string const& val) const -> std::string
+    {
+      return val;
+    }
+
+    template<convertible::direction>
+    auto
+    equal(std::string const& lhs, std::string const& rhs) const -> bool
+    {
+      return lower(lhs) == lower(rhs);
+    }
+
+    auto
+    hash_lhs(std::string const& val) const -> std::size_t
+    {
+      return std::hash<std::string>{}(lower(val));
+    }
+
+    auto
+    hash_rhs(std::string const& val) const -> std::size_t
+    {
+      return hash_lhs(val);
+    }
+  };
+
+  // counts conversions, estimated as more expensive to compare than any member type
+  struct costly_converter
+  {
+    static constexpr std::size_t equal_cost = 4;
+
+    int* calls = nullptr;
+
+    auto
+    operator()(int val) const -> int
+    {
+      ++*calls;
+      return val;
+    }
+  };
+
+  // counts copies (of the mappings holding it)
+  struct copy_counting_converter
+  {
+    int* copies = nullptr;
+
+    explicit copy_counting_converter(int& copiesRef)
+      : copies(&copiesRef)
+    {}
+
+    copy_counting_converter(copy_counting_converter const& other)
+      : copies(other.copies)
+    {
+      ++*copies;
+    }
+
+    copy_counting_converter(copy_counting_converter&&) noexcept = default;
+    ~copy_counting_converter()                                   = default;
+    auto operator=(copy_counting_converter const&) -> copy_counting_converter& = delete;
+    auto operator=(copy_counting_converter&&) -> copy_counting_converter&      = delete;
+
+    auto
+    operator()(int val) const -> int
+    {
+      return val;
+    }
+  };
+}
+
 SCENARIO("convertible: Mapping table")
 {
   using namespace convertible;
@@ -59,6 +213,64 @@ SCENARIO("convertible: Mapping table")
         REQUIRE(table.equal(lhs, rhs));
       }
     }
+    WHEN("diffing lhs & rhs")
+    {
+      lhs.val1 = 10;
+      lhs.val2 = "hello";
+      rhs.val1 = 10;
+      rhs.val2 = "world";
+
+      auto const mask = table.diff(lhs, rhs);
+      THEN("the mappings that differ are returned")
+      {
+        REQUIRE(mask.to_ulong() == 0b10);
+      }
+      AND_WHEN("assigning only those")
+      {
+        rhs.val1 = 20;
+        table.assign_masked<direction::lhs_to_rhs>(lhs, rhs, mask);
+        THEN("the others are left as-is")
+        {
+          REQUIRE(rhs.val1 == 20);
+          REQUIRE(rhs.val2 == "hello");
+          REQUIRE(table.diff(lhs, rhs).to_ulong() == 0b01);
+        }
+      }
+    }
+    WHEN("assigning lhs to rhs (parallel)")
+    {
+      lhs.val1 = 10;
+      lhs.val2 = "hello";
+      table.assign<direction::lhs_to_rhs>(execution::par, lhs, rhs);
+
+      THEN("lhs == rhs")
+      {
+        REQUIRE(table.equal(lhs, rhs));
+      }
+    }
+    WHEN("assigning lhs to rhs (concurrent mappings)")
+    {
+      lhs.val1 = 10;
+      lhs.val2 = "hello";
+      auto const policy = execution::parallel_policy{.concurrency = 2, .concurrent_mappings = true};
+      table.assign<direction::lhs_to_rhs>(policy, lhs, rhs);
+
+      THEN("lhs == rhs")
+      {
+        REQUIRE(table.equal(lhs, rhs));
+        REQUIRE(table.equal(policy, lhs, rhs));
+        REQUIRE(table.equal(execution::par, lhs, rhs));
+      }
+      AND_WHEN("one member differs")
+      {
+        rhs.val2 = "world";
+        THEN("lhs != rhs")
+        {
+          REQUIRE_FALSE(table.equal(policy, lhs, rhs));
+          REQUIRE_FALSE(table.equal(execution::par, lhs, rhs));
+        }
+      }
+    }
     WHEN("assigning lhs (r-value) to rhs")
     {
       lhs.val1 = 10;
@@ -111,6 +323,78 @@ SCENARIO("convertible: Mapping table")
     }
   }
 
+  GIVEN("mapping table between \n\n\ta.val1 <-> b.val1\n\ta.val2 <-> b.val2\n(batch)")
+  {
+    mapping_table table{mapping(member(&type_a::val1), member(&type_b::val1)),
+                        mapping(member(&type_a::val2), member(&type_b::val2))};
+
+    auto lhs = std::vector<type_a>{
+      {1, "1"},
+      {2, "2"},
+      {3, "3"}
+    };
+    auto rhs = std::vector<type_b>(lhs.size());
+
+    auto const expected = std::vector<type_b>{
+      {1, "1"},
+      {2, "2"},
+      {3, "3"}
+    };
+
+    WHEN("assigning lhs to rhs (row-wise)")
+    {
+      table.assign_batch<direction::lhs_to_rhs, traversal::row_wise>(std::span(lhs),
+                                                                     std::span(rhs));
+      THEN("lhs[i] == rhs[i]")
+      {
+        REQUIRE(rhs == expected);
+      }
+    }
+    WHEN("assigning lhs to rhs (column-wise)")
+    {
+      table.assign_batch<direction::lhs_to_rhs, traversal::column_wise>(std::span(lhs),
+                                                                        std::span(rhs));
+      THEN("lhs[i] == rhs[i]")
+      {
+        REQUIRE(rhs == expected);
+      }
+    }
+    WHEN("assigning rhs to lhs with fewer rhs")
+    {
+      rhs = {
+        {4, "4"}
+      };
+      table.assign_batch<direction::rhs_to_lhs>(std::span(lhs), std::span(rhs));
+      THEN("only the overlapping records are assigned")
+      {
+        REQUIRE(lhs[0].val1 == 4);
+        REQUIRE(lhs[0].val2 == "4");
+        REQUIRE(lhs[1].val1 == 2);
+        REQUIRE(lhs[2].val1 == 3);
+      }
+    }
+    WHEN("comparing lhs with rhs")
+    {
+      rhs = {
+        {1, "1"},
+        {2, "x"},
+        {0, "3"}
+      };
+      auto const expected_mask = std::vector<bool>{true, false, false};
+
+      THEN("mismatching records are flagged (row-wise)")
+      {
+        REQUIRE(table.equal_batch<direction::rhs_to_lhs, traversal::row_wise>(
+                  std::span(std::as_const(lhs)), std::span(std::as_const(rhs))) == expected_mask);
+      }
+      THEN("mismatching records are flagged (column-wise)")
+      {
+        REQUIRE(table.equal_batch<direction::rhs_to_lhs, traversal::column_wise>(
+                  std::span(std::as_const(lhs)), std::span(std::as_const(rhs))) == expected_mask);
+      }
+    }
+  }
+
   GIVEN("mapping table between \n\n\ta.val1 <-> b.val1\n\ta.val1 <-> c.val1\n")
   {
     mapping_table table{mapping(member(&type_a::val1), member(&type_b::val1)),
@@ -280,6 +564,18 @@ SCENARIO("convertible: Mapping table as a converter")
         REQUIRE(a.val == b.val);
       }
     }
+    WHEN("invoked with b (r-value)")
+    {
+      // long enough to not fit in the small string buffer
+      type_b b    = {"hello world, hello world"};
+      auto   data = b.val.data();
+      type_a a    = table(std::move(b));
+      THEN("it returns a with the buffer of b")
+      {
+        REQUIRE(a.val == "hello world, hello world");
+        REQUIRE(a.val.data() == data);
+      }
+    }
   }
   GIVEN("mapping table between \n\n\ta <-> b\n\tc <-> d\n")
   {
@@ -423,6 +719,449 @@ SCENARIO("convertible: Mapping table (misc use-cases)")
   }
 }
 
+SCENARIO("convertible: Mapping table incremental assign")
+{
+  using namespace convertible;
+
+  struct type_a
+  {
+    int              val1{};
+    std::vector<int> val2;
+  };
+
+  struct type_b
+  {
+    int              val1{};
+    std::vector<int> val2;
+  };
+
+  auto const table = mapping_table{mapping(member(&type_a::val1), member(&type_b::val1)),
+                                   mapping(member(&type_a::val2), member(&type_b::val2))};
+  auto tracker     = decltype(table)::change_tracker_t<direction::lhs_to_rhs, type_a>{};
+
+  auto lhs = type_a{1, {1, 2, 3}};
+  auto rhs = type_b{};
+  table.assign_changed<direction::lhs_to_rhs>(lhs, rhs, tracker);
+  REQUIRE(rhs.val1 == 1);
+  REQUIRE(rhs.val2 == std::vector<int>{1, 2, 3});
+
+  GIVEN("the target was modified since")
+  {
+    rhs.val1 = 10;
+    rhs.val2 = {};
+
+    WHEN("the source is unchanged")
+    {
+      table.assign_changed<direction::lhs_to_rhs>(lhs, rhs, tracker);
+      THEN("nothing is assigned")
+      {
+        REQUIRE(rhs.val1 == 10);
+        REQUIRE(rhs.val2.empty());
+      }
+    }
+    WHEN("one source member changed")
+    {
+      lhs.val2.push_back(4);
+      table.assign_changed<direction::lhs_to_rhs>(lhs, rhs, tracker);
+      THEN("only that member is assigned")
+      {
+        REQUIRE(rhs.val1 == 10);
+        REQUIRE(rhs.val2 == std::vector<int>{1, 2, 3, 4});
+      }
+    }
+    WHEN("the tracker is reset")
+    {
+      tracker.reset();
+      table.assign_changed<direction::lhs_to_rhs>(lhs, rhs, tracker);
+      THEN("everything is assigned")
+      {
+        REQUIRE(rhs.val1 == 1);
+        REQUIRE(rhs.val2 == std::vector<int>{1, 2, 3});
+      }
+    }
+  }
+  GIVEN("another target")
+  {
+    auto other = type_b{};
+    table.assign_changed<direction::lhs_to_rhs>(lhs, other, tracker);
+    THEN("everything is assigned")
+    {
+      REQUIRE(other.val1 == 1);
+      REQUIRE(other.val2 == std::vector<int>{1, 2, 3});
+    }
+  }
+  GIVEN("an optional source member")
+  {
+    struct type_c
+    {
+      std::optional<int> val;
+    };
+
+    struct type_d
+    {
+      int val{};
+    };
+
+    auto const optTable =
+      mapping_table{mapping(deref(maybe(member(&type_c::val))), member(&type_d::val))};
+    auto optTracker = decltype(optTable)::change_tracker_t<direction::lhs_to_rhs, type_c>{};
+    auto source     = type_c{5};
+    auto target     = type_d{};
+    optTable.assign_changed<direction::lhs_to_rhs>(source, target, optTracker);
+    REQUIRE(target.val == 5);
+
+    WHEN("it's reset & then set to a value hashing like a disabled one did")
+    {
+      source.val.reset();
+      optTable.assign_changed<direction::lhs_to_rhs>(source, target, optTracker);
+      REQUIRE(target.val == 5);
+      source.val = 0;
+      optTable.assign_changed<direction::lhs_to_rhs>(source, target, optTracker);
+
+      THEN("it's assigned")
+      {
+        REQUIRE(target.val == 0);
+      }
+    }
+  }
+  GIVEN("a source member changed to a value with the same hash")
+  {
+    lhs.val2 = {0, 61};
+    table.assign_changed<direction::lhs_to_rhs>(lhs, rhs, tracker);
+    REQUIRE(rhs.val2 == std::vector<int>{0, 61});
+
+    lhs.val2 = {1, 0};
+    REQUIRE(hash{}(lhs.val2) == hash{}(std::vector<int>{0, 61}));
+    table.assign_changed<direction::lhs_to_rhs>(lhs, rhs, tracker);
+
+    THEN("it's assigned")
+    {
+      REQUIRE(rhs.val2 == std::vector<int>{1, 0});
+    }
+  }
+}
+
+SCENARIO("convertible: Mapping table equality order")
+{
+  using namespace convertible;
+
+  struct type_a
+  {
+    int              val1{};
+    std::vector<int> val2;
+    std::string      val3;
+    int              val4{};
+  };
+
+  auto calls = 0;
+  auto table = mapping_table{
+    mapping(member(&type_a::val1), member(&type_a::val1), costly_converter{&calls}),
+    mapping(member(&type_a::val2), member(&type_a::val2)),
+    mapping(member(&type_a::val3), member(&type_a::val3)),
+    mapping(member(&type_a::val4), member(&type_a::val4))};
+
+  GIVEN("mappings of members of different types")
+  {
+    THEN("they're compared by increasing cost, then in declaration order")
+    {
+      constexpr auto order = decltype(table)::equal_order<type_a const&, type_a const&>();
+      static_assert(order == std::array<std::size_t, 4>{3, 2, 1, 0});
+    }
+  }
+  GIVEN("a cheap member that differs")
+  {
+    auto const lhs = type_a{1, {1, 2, 3}, "a", 1};
+    auto const rhs = type_a{1, {1, 2, 3}, "a", 2};
+
+    THEN("more expensive ones are not compared")
+    {
+      REQUIRE_FALSE(table.equal(lhs, rhs));
+      REQUIRE(calls == 0);
+    }
+  }
+  GIVEN("equal objects")
+  {
+    auto const lhs = type_a{1, {1, 2, 3}, "a", 1};
+
+    THEN("all members are compared")
+    {
+      REQUIRE(table.equal(lhs, lhs));
+      REQUIRE(calls == 1);
+    }
+  }
+}
+
+SCENARIO("convertible: Mapping table hashing")
+{
+  using namespace convertible;
+
+  struct type_a
+  {
+    int                        val1{};
+    std::string                val2;
+    std::vector<int>           val3;
+    std::map<std::string, int> val4;
+  };
+
+  struct type_b
+  {
+    std::string                                  val1;
+    std::string                                  val2;
+    std::vector<std::string>                     val3;
+    std::unordered_map<std::string, std::string> val4;
+  };
+
+  auto const table = mapping_table{
+    mapping(member(&type_a::val1), member(&type_b::val1), converter::numeric_string<int>{}),
+    mapping(member(&type_a::val2), member(&type_b::val2), case_insensitive{}),
+    mapping(member(&type_a::val3), member(&type_b::val3), converter::numeric_string<int>{}),
+    mapping(member(&type_a::val4), member(&type_b::val4), converter::numeric_string<int>{})};
+
+  auto const lhs = type_a{1, "Hello", {1, 2, 3}, {{"a", 1}, {"b", 2}, {"c", 3}}};
+
+  GIVEN("rhs equal to lhs")
+  {
+    auto const rhs = type_b{"1", "hello", {"1", "2", "3"}, {{"c", "3"}, {"a", "1"}, {"b", "2"}}};
+    REQUIRE(table.equal(lhs, rhs));
+
+    THEN("both hash equally")
+    {
+      REQUIRE(table.hash_lhs(lhs) == table.hash_rhs(rhs));
+    }
+  }
+  GIVEN("rhs not equal to lhs")
+  {
+    auto const rhs = type_b{"1", "hello", {"1", "2", "4"}, {{"c", "3"}, {"a", "1"}, {"b", "2"}}};
+    REQUIRE_FALSE(table.equal(lhs, rhs));
+
+    THEN("their hashes differ")
+    {
+      REQUIRE(table.hash_lhs(lhs) != table.hash_rhs(rhs));
+    }
+  }
+  GIVEN("the table as converter of a sequence")
+  {
+    auto const lhss = std::vector<type_a>{lhs, lhs};
+    auto const rhss = std::vector<type_b>(2, table(lhs));
+    auto const map  = mapping(identity(lhss), identity(rhss), table);
+    REQUIRE(map.equal(lhss, rhss));
+
+    THEN("both hash equally")
+    {
+      REQUIRE(map.hash_lhs(lhss) == map.hash_rhs(rhss));
+    }
+  }
+}
+
+SCENARIO("convertible: Mapping table with optional members")
+{
+  using namespace convertible;
+
+  struct type_a
+  {
+    std::optional<std::string> val1;
+    std::optional<int>         val2;
+  };
+
+  struct type_b
+  {
+    std::optional<std::string> val1;
+    int                        val2{};
+  };
+
+  auto const table =
+    mapping_table{mapping(deref(maybe(member(&type_a::val1))), deref(maybe(member(&type_b::val1)))),
+                  mapping(deref(maybe(member(&type_a::val2))), member(&type_b::val2))};
+
+  GIVEN("empty optionals")
+  {
+    auto lhs = type_a{};
+    auto rhs = type_b{std::nullopt, 1};
+
+    WHEN("comparing")
+    {
+      auto const equal = table.equal(lhs, rhs);
+
+      THEN("they're only read")
+      {
+        REQUIRE_FALSE(equal);
+        REQUIRE_FALSE(lhs.val1.has_value());
+        REQUIRE_FALSE(lhs.val2.has_value());
+        REQUIRE_FALSE(rhs.val1.has_value());
+      }
+    }
+    WHEN("assigning lhs to rhs")
+    {
+      table.assign<direction::lhs_to_rhs>(lhs, rhs);
+
+      THEN("neither side is modified")
+      {
+        REQUIRE_FALSE(lhs.val1.has_value());
+        REQUIRE_FALSE(rhs.val1.has_value());
+        REQUIRE(rhs.val2 == 1);
+      }
+    }
+    WHEN("assigning rhs to lhs")
+    {
+      table.assign<direction::rhs_to_lhs>(lhs, rhs);
+
+      THEN("only the optionals assigned to get a value")
+      {
+        REQUIRE_FALSE(lhs.val1.has_value());
+        REQUIRE(lhs.val2 == 1);
+      }
+    }
+  }
+  GIVEN("const objects")
+  {
+    auto const lhs = type_a{"hello", 1};
+    auto const rhs = type_b{"hello", 1};
+
+    THEN("they can be compared")
+    {
+      REQUIRE(table.equal(lhs, rhs));
+      REQUIRE_FALSE(table.equal(type_a{}, type_b{}));
+    }
+  }
+}
+
+SCENARIO("convertible: Mapping table extension")
+{
+  using namespace convertible;
+
+  struct type_a
+  {
+    int val1{};
+    int val2{};
+    int val3{};
+  };
+
+  struct type_b
+  {
+    int val1{};
+    int val2{};
+    int val3{};
+  };
+
+  auto copies = 0;
+  auto base   = mapping_table{
+    mapping(member(&type_a::val1), member(&type_b::val1), copy_counting_converter{copies}),
+    mapping(member(&type_a::val2), member(&type_b::val2), copy_counting_converter{copies})};
+  copies = 0;
+
+  auto const lhs = type_a{1, 2, 3};
+
+  THEN("its mappings can be accessed by reference")
+  {
+    static_assert(std::is_lvalue_reference_v<decltype(base.mappings())>);
+    REQUIRE(&base.mappings() == &std::as_const(base).mappings());
+    REQUIRE(copies == 0);
+  }
+  WHEN("extending an l-value table")
+  {
+    auto const table = extend(base, mapping(member(&type_a::val3), member(&type_b::val3)));
+
+    THEN("its mappings are copied once")
+    {
+      REQUIRE(copies == 2);
+      REQUIRE(table.equal(lhs, type_b{1, 2, 3}));
+    }
+  }
+  WHEN("extending an r-value table")
+  {
+    auto const table =
+      extend(std::move(base), mapping(member(&type_a::val3), member(&type_b::val3)));
+
+    THEN("its mappings are moved")
+    {
+      REQUIRE(copies == 0);
+      REQUIRE(table.equal(lhs, type_b{1, 2, 3}));
+    }
+  }
+  WHEN("extending a table with another table")
+  {
+    auto const table = extend(mapping_table{mapping(member(&type_a::val3), member(&type_b::val3))},
+                              std::move(base));
+
+    THEN("the other table's mappings are spliced in")
+    {
+      static_assert(std::tuple_size_v<std::remove_cvref_t<decltype(table.mappings())>> == 3);
+      REQUIRE(copies == 0);
+      REQUIRE(table.equal(lhs, type_b{1, 2, 3}));
+      REQUIRE_FALSE(table.equal(lhs, type_b{1, 0, 3}));
+    }
+  }
+}
+
+SCENARIO("convertible: Mapping table with context")
+{
+  using namespace convertible;
+
+  auto table = mapping_table{
+    mapping(custom(val1_reader{}), member(&record_b::val1), contextual_formatter{}),
+    mapping(member(&record_a::val2), member(&record_b::val2))};
+
+  auto context = context_t{};
+  auto lhs     = record_a{10, "hello"};
+  auto rhs     = record_b{};
+
+  GIVEN("a context")
+  {
+    WHEN("assigning lhs to rhs")
+    {
+      table.assign<direction::lhs_to_rhs>(lhs, rhs, context);
+
+      THEN("it's passed to the readers & converters accepting it")
+      {
+        REQUIRE(rhs.val1 == "10");
+        REQUIRE(rhs.val2 == "hello");
+        REQUIRE(context.conversions == 1);
+        REQUIRE(context.reads == 1);
+        REQUIRE(table.equal(lhs, rhs, context));
+        REQUIRE(context.conversions == 2);
+      }
+    }
+    WHEN("assigning rhs to lhs")
+    {
+      rhs = record_b{"20", "world"};
+      table.assign<direction::rhs_to_lhs>(lhs, rhs, context);
+
+      THEN("lhs == rhs")
+      {
+        REQUIRE(lhs.val1 == 20);
+        REQUIRE(lhs.val2 == "world");
+        REQUIRE(context.conversions == 1);
+      }
+    }
+    WHEN("converting lhs")
+    {
+      auto converted = table(lhs, context);
+
+      THEN("it's passed on")
+      {
+        static_assert(std::same_as<decltype(converted), record_b>);
+        REQUIRE(converted.val1 == "10");
+        REQUIRE(context.conversions == 1);
+      }
+    }
+    WHEN("the table is a (nested) converter of a sequence")
+    {
+      auto lhss = std::vector<record_a>{{1, "a"}, {2, "b"}, {3, "c"}};
+      auto rhss = std::vector<record_b>{};
+      auto map  = mapping(identity(lhss), identity(rhss), table);
+      map.assign<direction::lhs_to_rhs>(lhss, rhss, context);
+
+      THEN("it's passed to all elements")
+      {
+        REQUIRE(rhss.size() == 3);
+        REQUIRE(rhss[2].val1 == "3");
+        REQUIRE(context.conversions == 3);
+        REQUIRE(context.reads == 3);
+      }
+    }
+  }
+}
+
 namespace std
 {
   auto
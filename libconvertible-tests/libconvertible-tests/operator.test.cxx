@@ -1,13 +1,22 @@
 #include <convertible/operators.hxx>
 #include <libconvertible-tests/test_common.hxx>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
 #include <list>
 #include <map>
+#include <new>
+#include <numeric>
 #include <set>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <doctest/doctest.h>
@@ -23,6 +32,53 @@ namespace
   {
     return rhs == std::remove_cvref_t<decltype(rhs)>{};
   };
+
+  // counts its invocations, which only add up if it's passed by reference to nested containers
+  struct counting_converter
+  {
+    int calls = 0;
+
+    auto
+    operator()(int val) -> std::string
+    {
+      ++calls;
+      return std::to_string(val);
+    }
+
+    auto
+    operator()(std::string const& val) -> int
+    {
+      ++calls;
+      return std::stoi(val);
+    }
+  };
+
+  // incremented by the replaced global operator new (below)
+  std::atomic<std::size_t> allocations = 0; // NOLINT
+}
+
+// NOTE: kept out-of-line, or GCC will warn about 'free' not matching 'operator new' once inlined.
+[[gnu::noinline]] auto
+operator new(std::size_t size) -> void*
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto* ptr = std::malloc(size == 0 ? 1 : size)) // NOLINT
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void
+operator delete(void* ptr) noexcept
+{
+  std::free(ptr); // NOLINT
+}
+
+[[gnu::noinline]] void
+operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr); // NOLINT
 }
 
 TEST_CASE_TEMPLATE_DEFINE("it's invocable with types", arg_tuple_t, invocable_with_types)
@@ -46,6 +102,54 @@ TEST_CASE_TEMPLATE_DEFINE("it's invocable with types", arg_tuple_t, invocable_wi
   }
 }
 
+TEST_CASE_TEMPLATE_DEFINE("it recycles nodes of associative containers", arg_tuple_t,
+                          recycles_nodes)
+{
+  using lhs_t = std::tuple_element_t<0, arg_tuple_t>;
+  using rhs_t = std::tuple_element_t<1, arg_tuple_t>;
+
+  auto const makeRhs = [](int first)
+  {
+    auto rhs = rhs_t{};
+    for (int key = first; key < first + 100; ++key)
+    {
+      if constexpr (convertible::concepts::mapping_container<rhs_t>)
+      {
+        rhs.emplace(key, key);
+      }
+      else
+      {
+        rhs.emplace(key);
+      }
+    }
+    return rhs;
+  };
+
+  auto lhs = lhs_t{};
+  convertible::operators::assign{}(lhs, makeRhs(0));
+
+  // same number of keys, but (partially) different ones
+  for (int first : {1, 50, 1000})
+  {
+    auto const rhs    = makeRhs(first);
+    auto const before = allocations.load();
+    convertible::operators::assign{}(lhs, rhs);
+    auto const count = allocations.load() - before;
+
+    CAPTURE(first);
+    REQUIRE(count == 0);
+    REQUIRE(convertible::operators::equal{}(lhs, rhs));
+  }
+}
+
+TEST_CASE_TEMPLATE_INVOKE(recycles_nodes, std::tuple<std::map<int, long>, std::map<int, int>>);
+TEST_CASE_TEMPLATE_INVOKE(recycles_nodes,
+                          std::tuple<std::map<int, long>, std::unordered_map<int, int>>);
+TEST_CASE_TEMPLATE_INVOKE(recycles_nodes, std::tuple<std::unordered_map<int, long>,
+                                                     std::unordered_map<int, int>>);
+TEST_CASE_TEMPLATE_INVOKE(recycles_nodes, std::tuple<std::set<int>, std::set<int, std::greater<>>>);
+TEST_CASE_TEMPLATE_INVOKE(recycles_nodes, std::tuple<std::unordered_set<int>, std::set<int>>);
+
 template<typename lhs_t, typename rhs_t, typename converter_t = convertible::converter::identity,
          typename verify_t = decltype(verify_equal)>
 void
@@ -333,6 +437,99 @@ SCENARIO("convertible: Operators")
                              });
     }
 
+    WHEN("lhs vector<int>, rhs array<int>")
+    {
+      auto lhs = std::vector<int>{9};
+      auto rhs = std::array<int, 3>{1, 2, 3};
+
+      COPY_ASSIGNS_CORRECTLY(lhs, rhs, converter::identity{},
+                             [](auto const& lhs, auto const& rhs, auto const&)
+                             {
+                               return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+                             });
+    }
+
+    WHEN("lhs array<int>, rhs vector<int>")
+    {
+      auto lhs = std::array<int, 3>{9, 9, 9};
+      auto rhs = std::vector<int>{1, 2};
+
+      COPY_ASSIGNS_CORRECTLY(lhs, rhs, converter::identity{},
+                             [](auto const& lhs, auto const& rhs, auto const&)
+                             {
+                               return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == 9;
+                             });
+    }
+
+    WHEN("lhs int[3], rhs vector<int>")
+    {
+      int  lhs[3] = {9, 9, 9}; // NOLINT
+      auto rhs    = std::vector<int>{1, 2, 3, 4};
+
+      COPY_ASSIGNS_CORRECTLY(lhs, rhs, converter::identity{},
+                             [](auto const& lhs, auto const& rhs, auto const&)
+                             {
+                               return std::equal(std::begin(lhs), std::end(lhs), rhs.begin(),
+                                                 rhs.begin() + 3);
+                             });
+    }
+
+    WHEN("lhs vector<float>, rhs float[2]")
+    {
+      auto  lhs    = std::vector<float>{};
+      float rhs[2] = {1.5f, 2.5f}; // NOLINT
+
+      COPY_ASSIGNS_CORRECTLY(lhs, rhs, converter::identity{},
+                             [](auto const& lhs, auto const& rhs, auto const&)
+                             {
+                               return std::equal(lhs.begin(), lhs.end(), std::begin(rhs),
+                                                 std::end(rhs));
+                             });
+    }
+
+    WHEN("lhs vector<float>, rhs vector<int>")
+    {
+      auto lhs = std::vector<float>{};
+      auto rhs = std::vector<int>{1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12, 13, -14, 15, -16, 17};
+
+      COPY_ASSIGNS_CORRECTLY(lhs, rhs, converter::identity{},
+                             [](auto const& lhs, auto const& rhs, auto const&)
+                             {
+                               return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                 [](float lhs, int rhs)
+                                                 {
+                                                   return lhs == static_cast<float>(rhs);
+                                                 });
+                             });
+    }
+
+    WHEN("lhs array<short, 9>, rhs vector<int>")
+    {
+      auto lhs = std::array<short, 9>{};
+      auto rhs = std::vector<int>{1, -2, 3, -4, 5, -6, 7, -8, 65537};
+
+      COPY_ASSIGNS_CORRECTLY(lhs, rhs, converter::identity{},
+                             [](auto const& lhs, auto const& rhs, auto const&)
+                             {
+                               return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                 [](short lhs, int rhs)
+                                                 {
+                                                   return lhs == static_cast<short>(rhs);
+                                                 });
+                             });
+    }
+
+    WHEN("lhs array<int, 2>, rhs array<int, 3> (constant evaluated)")
+    {
+      constexpr auto lhs = []
+      {
+        auto lhs = std::array<int, 2>{};
+        operators::assign{}(lhs, std::array<int, 3>{1, 2, 3});
+        return lhs;
+      }();
+      static_assert(lhs[0] == 1 && lhs[1] == 2);
+    }
+
     WHEN("lhs set<int>, rhs set<int>")
     {
       auto lhs = std::set<int>{};
@@ -349,6 +546,251 @@ SCENARIO("convertible: Operators")
       // });
     }
 
+    WHEN("lhs vector<int>, rhs vector<string> (parallel)")
+    {
+      auto const policy = execution::parallel_policy{.concurrency = 4, .min_chunk = 8};
+
+      auto lhs = std::vector<int>{};
+      auto rhs = std::vector<std::string>(101);
+      for (std::size_t i = 0; i < rhs.size(); ++i)
+      {
+        rhs[i] = std::to_string(i);
+      }
+
+      auto& res = operators::assign{}(policy, lhs, rhs, intStringConverter);
+      THEN("lhs == rhs")
+      {
+        REQUIRE(&res == &lhs);
+        REQUIRE(lhs.size() == rhs.size());
+        REQUIRE(operators::equal{}(lhs, rhs, intStringConverter));
+      }
+    }
+
+    WHEN("lhs vector<float>, rhs vector<int> (parallel)")
+    {
+      auto const policy = execution::parallel_policy{.concurrency = 3, .min_chunk = 1};
+
+      auto lhs = std::vector<float>{};
+      auto rhs = std::vector<int>(1001);
+      std::iota(std::begin(rhs), std::end(rhs), -500);
+
+      operators::assign{}(policy, lhs, rhs);
+      THEN("lhs == rhs")
+      {
+        REQUIRE(std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs)));
+      }
+    }
+
+    WHEN("lhs list<int>, rhs list<string> (parallel)")
+    {
+      auto const policy = execution::parallel_policy{.concurrency = 4, .min_chunk = 1};
+
+      auto lhs = std::list<int>{};
+      auto rhs = std::list<std::string>{"1", "2", "3"};
+
+      operators::assign{}(policy, lhs, rhs, intStringConverter);
+      THEN("it's assigned sequentially")
+      {
+        REQUIRE(lhs == std::list<int>{1, 2, 3});
+      }
+    }
+
+    WHEN("lhs vector<int>, rhs vector<int> (r-value)")
+    {
+      auto lhs  = std::vector<int>{};
+      auto rhs  = std::vector<int>{1, 2, 3};
+      auto data = rhs.data();
+
+      operators::assign{}(lhs, std::move(rhs));
+      THEN("rhs buffer is handed over to lhs")
+      {
+        REQUIRE(lhs.data() == data);
+        REQUIRE(lhs == std::vector<int>{1, 2, 3});
+      }
+    }
+
+    WHEN("lhs map<int, string>, rhs map<int, string, greater> (r-value)")
+    {
+      auto lhs  = std::map<int, std::string>{
+        {0, "0"}
+      };
+      auto rhs  = std::map<int, std::string, std::greater<>>{
+        {1, "1"},
+        {2, "2"}
+      };
+      auto node = &rhs.at(2);
+
+      operators::assign{}(lhs, std::move(rhs));
+      THEN("rhs nodes are handed over to lhs")
+      {
+        REQUIRE(&lhs.at(2) == node);
+        REQUIRE(lhs == std::map<int, std::string>{
+                         {1, "1"},
+                         {2, "2"}
+        });
+        REQUIRE(rhs.empty());
+      }
+    }
+
+    WHEN("lhs map<int, string>, rhs map<int, int> (overlapping keys)")
+    {
+      auto lhs  = std::map<int, std::string>{
+        {0, "0"},
+        {1, "1"}
+      };
+      auto rhs  = std::map<int, int>{
+        {1, 10},
+        {2, 20}
+      };
+      auto node = &lhs.at(1);
+
+      operators::assign{}(lhs, rhs, intStringConverter);
+      THEN("surviving nodes are updated in place & removed keys are erased")
+      {
+        REQUIRE(&lhs.at(1) == node);
+        REQUIRE(lhs == std::map<int, std::string>{
+                         {1, "10"},
+                         {2, "20"}
+        });
+      }
+    }
+
+    WHEN("lhs map<int, long>, rhs map<int, int> (interleaved keys)")
+    {
+      auto lhs = std::map<int, long>{
+        {0, 0},
+        {2, 0},
+        {4, 0},
+        {6, 0}
+      };
+      auto rhs = std::map<int, int>{
+        {1, 1},
+        {2, 2},
+        {3, 3},
+        {6, 6},
+        {7, 7}
+      };
+
+      operators::assign{}(lhs, rhs);
+      THEN("lhs == rhs")
+      {
+        REQUIRE(lhs == std::map<int, long>{
+                         {1, 1},
+                         {2, 2},
+                         {3, 3},
+                         {6, 6},
+                         {7, 7}
+        });
+      }
+    }
+
+    WHEN("lhs map<int, long> (empty), rhs unordered_map<int, int>")
+    {
+      auto lhs = std::map<int, long>{};
+      auto rhs = std::unordered_map<int, int>{
+        {2, 2},
+        {1, 1}
+      };
+
+      operators::assign{}(lhs, rhs);
+      THEN("lhs == rhs")
+      {
+        REQUIRE(lhs == std::map<int, long>{
+                         {1, 1},
+                         {2, 2}
+        });
+      }
+    }
+
+    WHEN("lhs unordered_map<int, int>, rhs unordered_map<int, string> (overlapping keys)")
+    {
+      auto lhs  = std::unordered_map<int, int>{
+        {0, 0},
+        {1, 1}
+      };
+      auto rhs  = std::unordered_map<int, std::string>{
+        {1, "10"},
+        {2, "20"}
+      };
+      auto node = &lhs.at(1);
+
+      operators::assign{}(lhs, rhs, intStringConverter);
+      THEN("surviving nodes are updated in place & removed keys are erased")
+      {
+        REQUIRE(&lhs.at(1) == node);
+        REQUIRE(lhs == std::unordered_map<int, int>{
+                         {1, 10},
+                         {2, 20}
+        });
+      }
+    }
+
+    WHEN("lhs set<int>, rhs set<int, greater> (overlapping keys)")
+    {
+      auto lhs  = std::set<int>{0, 1};
+      auto rhs  = std::set<int, std::greater<>>{1, 2};
+      auto node = &*lhs.find(1);
+
+      operators::assign{}(lhs, rhs);
+      THEN("surviving nodes are kept & removed keys are erased")
+      {
+        REQUIRE(&*lhs.find(1) == node);
+        REQUIRE(lhs == std::set<int>{1, 2});
+      }
+    }
+
+    WHEN("lhs set<int>, rhs set<double> (lossy keys)")
+    {
+      auto lhs = std::set<int>{1, 7};
+      auto rhs = std::set<double>{1.5};
+
+      operators::assign{}(lhs, rhs);
+      THEN("keys of lhs are the converted keys of rhs")
+      {
+        REQUIRE(lhs == std::set<int>{1});
+      }
+    }
+
+    WHEN("lhs map<int, string>, rhs map<double, string> (lossy keys)")
+    {
+      auto lhs = std::map<int, std::string>{{1, "a"}, {7, "b"}};
+      auto rhs = std::map<double, std::string>{{1.5, "x"}};
+
+      operators::assign{}(lhs, rhs);
+      THEN("keys of lhs are the converted keys of rhs")
+      {
+        REQUIRE(lhs == std::map<int, std::string>{{1, "x"}});
+      }
+    }
+
+    WHEN("lhs unordered_map<int, string>, rhs map<double, string> (non-injective keys)")
+    {
+      auto lhs = std::unordered_map<int, std::string>{{1, "a"}, {2, "b"}, {7, "c"}};
+      auto rhs = std::map<double, std::string>{{1.25, "x"}, {1.5, "x"}, {2.5, "y"}};
+
+      operators::assign{}(lhs, rhs);
+      THEN("keys of lhs are the converted keys of rhs")
+      {
+        REQUIRE(lhs == std::unordered_map<int, std::string>{{1, "x"}, {2, "y"}});
+      }
+    }
+
+    WHEN("lhs set<int>, rhs set<int> (non-injective converter)")
+    {
+      auto lhs = std::set<int>{5};
+      auto rhs = std::set<int>{-1, 1};
+
+      operators::assign{}(lhs, rhs,
+                          [](int val)
+                          {
+                            return -val;
+                          });
+      THEN("converted elements are compared with converted elements")
+      {
+        REQUIRE(lhs == std::set<int>{-1, 1});
+      }
+    }
+
     // WHEN("lhs set<int>, rhs set<string>")
     // {
     //   auto lhs = std::set<int>{};
@@ -532,6 +974,22 @@ SCENARIO("convertible: Operators")
       //   return rhs == "";
       // });
     }
+    WHEN("converter is stateful")
+    {
+      auto lhs       = std::vector<std::vector<std::string>>{};
+      auto rhs       = std::vector<std::vector<int>>{{1, 2}, {3}};
+      auto converter = counting_converter{};
+
+      operators::assign{}(lhs, rhs, converter);
+      THEN("the same converter is used for all elements")
+      {
+        REQUIRE(lhs == std::vector<std::vector<std::string>>{{"1", "2"}, {"3"}});
+        REQUIRE(converter.calls == 3);
+
+        REQUIRE(operators::equal{}(lhs, rhs, converter));
+        REQUIRE(converter.calls == 6);
+      }
+    }
   }
 
   GIVEN("equal operator")
@@ -685,6 +1143,65 @@ SCENARIO("convertible: Operators")
       EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
     }
 
+    WHEN("lhs vector<int>, rhs array<int>")
+    {
+      auto lhs = std::vector<int>{1, 2, 3};
+      auto rhs = std::array<int, 3>{1, 2, 3};
+
+      EQUALITY_COMPARES_CORRECTLY(true, lhs, rhs);
+      rhs = {1, 2, 4};
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+    }
+
+    WHEN("lhs vector<int>, rhs vector<long long>")
+    {
+      // spans multiple chunks (see 'simd::equal')
+      auto lhs = std::vector<int>(1001);
+      std::iota(std::begin(lhs), std::end(lhs), -500);
+      auto rhs = std::vector<long long>(std::begin(lhs), std::end(lhs));
+
+      EQUALITY_COMPARES_CORRECTLY(true, lhs, rhs);
+      rhs.back() += 1ll << 32;
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+    }
+
+    WHEN("lhs vector<int>, rhs vector<string> (parallel)")
+    {
+      auto const policy = execution::parallel_policy{.concurrency = 4, .min_chunk = 8};
+
+      auto lhs = std::vector<int>(5000);
+      auto rhs = std::vector<std::string>(lhs.size());
+      for (std::size_t i = 0; i < lhs.size(); ++i)
+      {
+        lhs[i] = static_cast<int>(i);
+        rhs[i] = std::to_string(i);
+      }
+
+      THEN("it's equal to the sequential result")
+      {
+        REQUIRE(operators::equal{}(policy, lhs, rhs, intStringConverter));
+        for (auto i : {std::size_t{0}, lhs.size() / 2, lhs.size() - 1})
+        {
+          auto modified = rhs;
+          modified[i]   = "-1";
+          REQUIRE_FALSE(operators::equal{}(policy, lhs, modified, intStringConverter));
+          REQUIRE_FALSE(operators::equal{}(lhs, modified, intStringConverter));
+        }
+        rhs.pop_back();
+        REQUIRE_FALSE(operators::equal{}(policy, lhs, rhs, intStringConverter));
+      }
+    }
+
+    WHEN("lhs vector<float>, rhs array<double>")
+    {
+      auto lhs = std::vector<float>{0.5f, -0.0f, 3.f};
+      auto rhs = std::array<double, 3>{0.5, 0.0, 3.0};
+
+      EQUALITY_COMPARES_CORRECTLY(true, lhs, rhs);
+      rhs = {0.5, 0.0, 3.1};
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+    }
+
     // WHEN("lhs set<int>, rhs set<string>")
     // {
     //   auto lhs = std::set<int>{ 1 };
@@ -751,6 +1268,50 @@ SCENARIO("convertible: Operators")
       EQUALITY_COMPARES_CORRECTLY(true, lhs, rhs);
     }
 
+    WHEN("lhs map<int, long>, rhs map<int, int>")
+    {
+      auto lhs = std::map<int, long>{
+        {1, 1},
+        {2, 2}
+      };
+      auto rhs = std::map<int, int>{
+        {1, 1},
+        {2, 2}
+      };
+
+      EQUALITY_COMPARES_CORRECTLY(true, lhs, rhs);
+      rhs = {
+        {1, 1},
+        {3, 2}
+      };
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+      rhs = {
+        {1, 1},
+        {2, 3}
+      };
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+      rhs = {
+        {1, 1},
+        {2, 2},
+        {3, 3}
+      };
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+    }
+
+    WHEN("lhs unordered_map<int, int>, rhs map<int, int> (different sizes)")
+    {
+      auto lhs = std::unordered_map<int, int>{
+        {1, 1}
+      };
+      auto rhs = std::map<int, int>{
+        {1, 1},
+        {2, 2}
+      };
+
+      EQUALITY_COMPARES_CORRECTLY(false, lhs, rhs);
+      EQUALITY_COMPARES_CORRECTLY(false, rhs, lhs);
+    }
+
     WHEN("lhs unordered_map<int, unordered_map<int, int>>, rhs unordered_map<int, "
          "unordered_map<int, string>>")
     {
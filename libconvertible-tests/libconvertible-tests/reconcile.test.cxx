@@ -0,0 +1,113 @@
+#include <convertible/convertible.hxx>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+namespace
+{
+  struct record_a
+  {
+    int         id{};
+    std::string name;
+    int         value{};
+  };
+
+  struct record_b
+  {
+    std::string id;
+    std::string name;
+    int         value{};
+  };
+}
+
+SCENARIO("convertible: Reconcile")
+{
+  using namespace convertible;
+
+  auto const key   = mapping(member(&record_a::id), member(&record_b::id),
+                             converter::numeric_string<int>{});
+  auto const table = mapping_table{key, mapping(member(&record_a::name), member(&record_b::name)),
+                                   mapping(member(&record_a::value), member(&record_b::value))};
+  auto const sync  = reconciler(table, key);
+
+  auto lhs = std::vector<record_a>{{1, "a", 1}, {2, "b", 2}, {3, "c", 3}};
+  auto rhs = std::vector<record_b>{{"3", "c", 30}, {"4", "d", 4}, {"1", "a", 1}};
+
+  GIVEN("collections with inserted, updated, erased & unchanged records")
+  {
+    WHEN("planning rhs to lhs")
+    {
+      auto const plan = sync.plan<direction::rhs_to_lhs>(lhs, rhs);
+
+      THEN("each change is found by index")
+      {
+        REQUIRE(plan.inserts == std::vector<std::size_t>{1});
+        auto const updates = std::vector<std::pair<std::size_t, std::size_t>>{{2, 0}};
+        REQUIRE(plan.updates == updates);
+        REQUIRE(plan.erases == std::vector<std::size_t>{1});
+      }
+    }
+    WHEN("assigning rhs to lhs")
+    {
+      sync.assign<direction::rhs_to_lhs>(lhs, rhs);
+
+      THEN("lhs holds the records of rhs (kept ones in their order, inserted ones last)")
+      {
+        REQUIRE(lhs.size() == 3);
+        REQUIRE(lhs[0].id == 1);
+        REQUIRE(lhs[1].id == 3);
+        REQUIRE(lhs[1].value == 30);
+        REQUIRE(lhs[2].id == 4);
+        REQUIRE(lhs[2].name == "d");
+        REQUIRE(sync.plan<direction::rhs_to_lhs>(lhs, rhs).empty());
+      }
+    }
+    WHEN("assigning lhs to rhs")
+    {
+      sync.assign<direction::lhs_to_rhs>(lhs, rhs);
+
+      THEN("rhs holds the records of lhs")
+      {
+        REQUIRE(rhs.size() == 3);
+        REQUIRE(rhs[0].value == 3);
+        REQUIRE(rhs[1].id == "1");
+        REQUIRE(rhs[2].id == "2");
+        REQUIRE(sync.plan<direction::lhs_to_rhs>(lhs, rhs).empty());
+      }
+    }
+  }
+  GIVEN("duplicate keys")
+  {
+    rhs.push_back({"1", "a", 10});
+
+    WHEN("assigning rhs to lhs")
+    {
+      auto const plan = sync.assign<direction::rhs_to_lhs>(lhs, rhs);
+
+      THEN("they're matched at most once")
+      {
+        REQUIRE(plan.inserts == std::vector<std::size_t>{1, 3});
+        REQUIRE(lhs.size() == 4);
+        REQUIRE(lhs[3].value == 10);
+      }
+    }
+  }
+  GIVEN("equal collections with duplicate keys")
+  {
+    lhs = std::vector<record_a>{{1, "a", 1}, {1, "b", 2}, {1, "c", 3}};
+    rhs = std::vector<record_b>{{"1", "a", 1}, {"1", "b", 2}, {"1", "c", 3}};
+
+    WHEN("planning either way")
+    {
+      THEN("duplicates are paired up in order, ie. nothing changes")
+      {
+        REQUIRE(sync.plan<direction::rhs_to_lhs>(lhs, rhs).empty());
+        REQUIRE(sync.plan<direction::lhs_to_rhs>(lhs, rhs).empty());
+      }
+    }
+  }
+}
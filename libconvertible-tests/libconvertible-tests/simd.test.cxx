@@ -0,0 +1,158 @@
+#include <convertible/simd.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+using namespace convertible;
+
+namespace vectorizable
+{
+#if defined(__x86_64__) || defined(_M_X64)
+  static_assert(simd::vectorizable<std::int32_t, float>);
+  static_assert(simd::vectorizable<float, std::int32_t>);
+  static_assert(simd::vectorizable<std::int32_t, double>);
+  static_assert(simd::vectorizable<double, std::int32_t>);
+  static_assert(simd::vectorizable<float, double>);
+  static_assert(simd::vectorizable<double, float>);
+  static_assert(simd::vectorizable<std::int16_t, std::int32_t>);
+  static_assert(simd::vectorizable<std::int32_t, std::int16_t>);
+  static_assert(simd::vectorizable<std::int32_t, std::int64_t>);
+  static_assert(simd::vectorizable<std::int32_t const, std::int64_t>);
+#endif
+  static_assert(!simd::vectorizable<std::uint32_t, float>);
+  static_assert(!simd::vectorizable<bool, std::int32_t>);
+  static_assert(!simd::vectorizable<char, std::int32_t>);
+  static_assert(!simd::vectorizable<std::int32_t, std::int32_t>);
+}
+
+namespace comparable
+{
+  static_assert(simd::comparable<std::int32_t, std::int32_t>);
+  static_assert(simd::comparable<long, long long>);
+  static_assert(simd::comparable<float, float>);
+#if defined(__x86_64__) || defined(_M_X64)
+  static_assert(simd::comparable<std::int32_t, std::int64_t>);
+  static_assert(simd::comparable<std::int16_t, std::int32_t>);
+  static_assert(simd::comparable<std::int32_t, float>);
+  static_assert(simd::comparable<float, double>);
+#endif
+  static_assert(!simd::comparable<std::int16_t, std::int64_t>);
+  static_assert(!simd::comparable<std::int64_t, double>);
+  static_assert(!simd::comparable<std::uint32_t, std::int32_t>);
+}
+
+namespace
+{
+  template<typename from_t, typename to_t>
+  auto
+  make_input(std::size_t count)
+  {
+    std::vector<from_t> src(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto const sign = (i % 2 == 0) ? 1 : -1;
+      if constexpr (std::is_floating_point_v<from_t>)
+      {
+        // keep within the range of any (integer) target type
+        src[i] = static_cast<from_t>(sign * static_cast<double>(i) * 1.37);
+      }
+      else if constexpr (sizeof(from_t) > sizeof(to_t) && std::is_integral_v<to_t>)
+      {
+        // values outside the range of the (narrower) target type to verify truncation
+        src[i] = static_cast<from_t>(sign * static_cast<std::int64_t>(i) * 104729);
+      }
+      else
+      {
+        src[i] = static_cast<from_t>(sign * static_cast<std::int64_t>(i) * 7);
+      }
+    }
+    return src;
+  }
+}
+
+TEST_CASE_TEMPLATE_DEFINE("converts like static_cast", arg_tuple_t, converts_like_static_cast)
+{
+  using from_t = std::tuple_element_t<0, arg_tuple_t>;
+  using to_t   = std::tuple_element_t<1, arg_tuple_t>;
+
+  // odd count to exercise the scalar tail of each kernel
+  constexpr std::size_t count = 1003;
+
+  auto const src = make_input<from_t, to_t>(count);
+
+  std::vector<to_t> expected(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    expected[i] = static_cast<to_t>(src[i]);
+  }
+
+  for (auto level : {simd::isa::scalar, simd::isa::sse2, simd::isa::avx2})
+  {
+    if (level > simd::supported_isa())
+    {
+      continue;
+    }
+    std::vector<to_t> dst(count);
+    simd::convert(src.data(), dst.data(), count, level);
+    INFO("isa: ", static_cast<int>(level));
+    REQUIRE(dst == expected);
+  }
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<std::int32_t, float>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<float, std::int32_t>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<std::int32_t, double>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<double, std::int32_t>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<float, double>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<double, float>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<std::int16_t, std::int32_t>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<std::int32_t, std::int16_t>);
+TEST_CASE_TEMPLATE_INVOKE(converts_like_static_cast, std::tuple<std::int32_t, std::int64_t>);
+#endif
+
+TEST_CASE_TEMPLATE_DEFINE("compares like operator==", arg_tuple_t, compares_like_operator_equal)
+{
+  using lhs_t = std::tuple_element_t<0, arg_tuple_t>;
+  using rhs_t = std::tuple_element_t<1, arg_tuple_t>;
+
+  // spans multiple chunks with a partial last one
+  constexpr std::size_t count = 1003;
+
+  auto const lhs = make_input<lhs_t, rhs_t>(count);
+  auto       rhs = std::vector<rhs_t>(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    rhs[i] = static_cast<rhs_t>(lhs[i]);
+  }
+
+  for (auto level : {simd::isa::scalar, simd::isa::sse2, simd::isa::avx2})
+  {
+    if (level > simd::supported_isa())
+    {
+      continue;
+    }
+    INFO("isa: ", static_cast<int>(level));
+    REQUIRE(simd::equal(lhs.data(), rhs.data(), count, level));
+    for (auto i : {std::size_t{0}, count / 2, count - 1})
+    {
+      auto modified = rhs;
+      modified[i]   = static_cast<rhs_t>(modified[i] + 1);
+      REQUIRE_FALSE(simd::equal(lhs.data(), modified.data(), count, level));
+    }
+  }
+}
+
+TEST_CASE_TEMPLATE_INVOKE(compares_like_operator_equal, std::tuple<std::int32_t, std::int32_t>);
+TEST_CASE_TEMPLATE_INVOKE(compares_like_operator_equal, std::tuple<float, float>);
+#if defined(__x86_64__) || defined(_M_X64)
+TEST_CASE_TEMPLATE_INVOKE(compares_like_operator_equal, std::tuple<std::int32_t, std::int64_t>);
+TEST_CASE_TEMPLATE_INVOKE(compares_like_operator_equal, std::tuple<std::int16_t, std::int32_t>);
+TEST_CASE_TEMPLATE_INVOKE(compares_like_operator_equal, std::tuple<std::int32_t, double>);
+TEST_CASE_TEMPLATE_INVOKE(compares_like_operator_equal, std::tuple<float, double>);
+#endif
@@ -106,6 +106,17 @@ namespace fixed_size_container
   static_assert(!concepts::fixed_size_container<std::set<int> const&>);
 }
 
+namespace contiguous_container
+{
+  static_assert(concepts::contiguous_container<int[1]>);
+  static_assert(concepts::contiguous_container<std::array<int, 1> const&>);
+  static_assert(concepts::contiguous_container<std::vector<int>&>);
+  static_assert(concepts::contiguous_container<std::string const&>);
+  static_assert(!concepts::contiguous_container<std::vector<bool>&>);
+  static_assert(!concepts::contiguous_container<std::list<int>&>);
+  static_assert(!concepts::contiguous_container<std::set<int>&>);
+}
+
 namespace sequence_container
 {
   static_assert(concepts::sequence_container<std::array<int, 0> const&>);
@@ -4,14 +4,64 @@
 #include <convertible/concepts.hxx>
 #include <convertible/readers.hxx>
 
+#include <type_traits>
+
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
 namespace convertible
 {
-  template<typename _adaptee_t = details::any, typename reader_t = reader::identity<_adaptee_t>>
+  namespace details
+  {
+    // Default adaptee of an adapter: a copy of the one given at construction if 'kept', else
+    // value-initialized on demand (ie. stateless).
+    template<typename value_t, bool kept = false>
+    struct default_adaptee
+    {
+      constexpr default_adaptee() = default;
+
+      // (an empty adaptee has no state to keep)
+      constexpr explicit default_adaptee(value_t const&)
+        requires std::is_empty_v<value_t>
+      {}
+
+      constexpr auto
+      value() const
+      {
+        return value_t{};
+      }
+    };
+
+    template<typename value_t>
+    struct default_adaptee<value_t, true>
+    {
+      constexpr explicit default_adaptee(value_t const& value)
+        : value_(value)
+      {}
+
+      constexpr auto
+      value() const
+      {
+        return value_;
+      }
+
+    private:
+      value_t value_;
+    };
+
+    // Default adaptee of an adapter constructed with a 'value_t' adaptee ('given') or without:
+    // kept if given, unless it's of an empty type that can be value-initialized instead.
+    template<typename value_t, bool given = true>
+    using default_adaptee_t = default_adaptee<
+      value_t, given && !(std::is_empty_v<value_t> && std::is_default_constructible_v<value_t>)>;
+  }
+
+  template<typename _adaptee_t = details::any, typename reader_t = reader::identity<_adaptee_t>,
+           typename _default_adaptee_t =
+             details::default_adaptee<std::remove_reference_t<_adaptee_t>>>
   struct adapter
   {
     using adaptee_t                           = _adaptee_t;
+    using default_adaptee_t                   = _default_adaptee_t;
     using adaptee_value_t                     = std::remove_reference_t<adaptee_t>;
     static constexpr bool accepts_any_adaptee = std::is_same_v<adaptee_value_t, details::any>;
 
@@ -37,6 +87,21 @@ namespace convertible
       return reader_(FWD(obj));
     }
 
+    // Same as above, but with a per-call context passed on to the reader if it accepts it.
+    constexpr auto
+    operator()(auto&& obj, auto& context) const -> decltype(auto)
+      requires requires (adapter const& self) { self(FWD(obj)); }
+    {
+      if constexpr (requires { reader_(FWD(obj), context); })
+      {
+        return reader_(FWD(obj), context);
+      }
+      else
+      {
+        return (*this)(FWD(obj));
+      }
+    }
+
     constexpr auto
     reader() const -> auto const&
     {
@@ -70,17 +135,45 @@ namespace convertible
       }
     }
 
+    // Invokes 'fn' with what's read from 'obj' (with 'context', if any) if enabled, returning
+    // whether it was. Readers may provide a 'read_if' doing both in one pass (eg. composed
+    // readers, which otherwise walk the chain once to check it & once more to read).
+    constexpr auto
+    read_if(auto&& obj, auto&& fn, auto&... context) const -> bool
+      requires requires (adapter const& self) { self(FWD(obj), context...); }
+    {
+      if constexpr (sizeof...(context) == 0 && requires { reader_.read_if(FWD(obj), fn); })
+      {
+        return reader_.read_if(FWD(obj), fn);
+      }
+      else
+      {
+        if (!enabled(FWD(obj)))
+        {
+          return false;
+        }
+        FWD(fn)((*this)(FWD(obj), context...));
+        return true;
+      }
+    }
+
+    // The adaptee given at construction, if any (& not empty), else a value-initialized one.
     constexpr auto
     defaulted_adaptee() const
       requires (!accepts_any_adaptee)
     {
-      return adaptee_;
+      return adaptee_.value();
     }
 
   private:
-    reader_t        reader_;
-    adaptee_value_t adaptee_{};
+    CONVERTIBLE_NO_UNIQUE_ADDRESS reader_t          reader_;
+    CONVERTIBLE_NO_UNIQUE_ADDRESS default_adaptee_t adaptee_{};
   };
+
+  // An adaptee given at construction is kept as default adaptee (see 'defaulted_adaptee').
+  template<typename adaptee_t, typename reader_t>
+  adapter(adaptee_t, reader_t)
+    -> adapter<adaptee_t, reader_t, details::default_adaptee_t<adaptee_t>>;
 }
 
 #undef FWD
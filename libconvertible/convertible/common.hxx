@@ -4,6 +4,13 @@
 #include <concepts>
 #include <iterator>
 
+// MSVC ignores '[[no_unique_address]]' (for ABI compatibility), but honors its own spelling.
+#if defined(_MSC_VER) && !defined(__clang__)
+  #define CONVERTIBLE_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+  #define CONVERTIBLE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 namespace convertible
 {
   namespace details
@@ -61,4 +68,13 @@ namespace convertible
     lhs_to_rhs,
     rhs_to_lhs
   };
+
+  // Order in which a batch of records is visited (see 'mapping_table::assign_batch'):
+  // - row_wise: all mappings for one record, then the next record
+  // - column_wise: one mapping for all records, then the next mapping
+  enum class traversal
+  {
+    row_wise,
+    column_wise
+  };
 }
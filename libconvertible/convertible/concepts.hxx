@@ -5,13 +5,14 @@
 #include <convertible/std_concepts_ext.hxx>
 
 #include <concepts>
+#include <cstddef>
 #include <type_traits>
 
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
 namespace convertible
 {
-  template<typename obj_t, typename reader_t>
+  template<typename obj_t, typename reader_t, typename default_adaptee_t>
   struct adapter;
 
   namespace traits
@@ -65,15 +66,20 @@ namespace convertible
                                                         };
       };
 
-    template<typename mapping_t, typename lhs_t, typename rhs_t, direction dir>
-    concept mappable_assign = requires (mapping_t&& map, lhs_t&& lhs, rhs_t&& rhs) {
-                                FWD(map).template assign<dir>(FWD(lhs), FWD(rhs));
-                              };
+    // 'context_ts' is the (optional) per-call context (see 'converter::contextual').
+    template<typename mapping_t, typename lhs_t, typename rhs_t, direction dir,
+             typename... context_ts>
+    concept mappable_assign =
+      requires (mapping_t&& map, lhs_t&& lhs, rhs_t&& rhs, context_ts&... context) {
+        FWD(map).template assign<dir>(FWD(lhs), FWD(rhs), context...);
+      };
 
-    template<typename mapping_t, typename lhs_t, typename rhs_t, direction dir>
-    concept mappable_equal = requires (mapping_t&& map, lhs_t&& lhs, rhs_t&& rhs) {
-                               FWD(map).template equal<dir>(FWD(lhs), FWD(rhs));
-                             };
+    template<typename mapping_t, typename lhs_t, typename rhs_t, direction dir,
+             typename... context_ts>
+    concept mappable_equal =
+      requires (mapping_t&& map, lhs_t&& lhs, rhs_t&& rhs, context_ts&... context) {
+        FWD(map).template equal<dir>(FWD(lhs), FWD(rhs), context...);
+      };
 
     template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
     concept assignable_from_converted =
@@ -88,6 +94,13 @@ namespace convertible
                 traits::converted_t<converter_t, traits::rhs_t<dir, lhs_t, rhs_t>>&& rhs) {
         { FWD(lhs) == FWD(rhs) } -> std::convertible_to<bool>;
       };
+
+    // Splits '[0, count)' into chunks & invokes 'fn(first, last)' for each (see 'execution.hxx').
+    template<typename policy_t>
+    concept execution_policy =
+      requires (std::remove_cvref_t<policy_t> const& policy) {
+        policy.bulk(std::size_t{}, [](std::size_t, std::size_t) {});
+      };
   }
 
   template<concepts::adapter _lhs_adapter_t, concepts::adapter _rhs_adapter_t,
@@ -131,6 +144,20 @@ namespace convertible
     template<typename... arg_ts>
     struct is_mapping<mapping_table<arg_ts...>> : std::true_type
     {};
+
+    template<typename... arg_ts>
+    struct is_mapping_table : std::false_type
+    {};
+
+    template<typename... arg_ts>
+    struct is_mapping_table<mapping_table<arg_ts...>> : std::true_type
+    {};
+  }
+
+  namespace traits
+  {
+    template<typename T>
+    constexpr bool is_mapping_table_v = details::is_mapping_table<std::remove_cvref_t<T>>::value;
   }
 }
 
@@ -1,9 +1,25 @@
 #pragma once
 
+#include <convertible/common.hxx>
 #include <convertible/concepts.hxx>
 #include <convertible/std_concepts_ext.hxx>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
@@ -47,6 +63,462 @@ namespace convertible::converter
 
     converter_t& converter_; // NOLINT
   };
+
+  // Passes a per-call context (eg. an arena, scratch buffers or a statistics sink) as trailing
+  // argument to 'converter_t' (& its 'assign'/'equal') wherever it accepts one, and otherwise
+  // invokes it as usual. Operators pass converters by reference, so the context reaches every
+  // nested level (including nested mappings).
+  template<typename converter_t, typename context_t>
+  struct contextual
+  {
+    constexpr contextual(converter_t& converter, context_t& context)
+      : converter_(converter)
+      , context_(context)
+    {}
+
+    constexpr auto
+    operator()(auto&& arg) const -> decltype(auto)
+      requires std::invocable<converter_t&, decltype(arg), context_t&> ||
+               std::invocable<converter_t&, decltype(arg)>
+    {
+      if constexpr (std::invocable<converter_t&, decltype(arg), context_t&>)
+      {
+        return converter_(FWD(arg), context_);
+      }
+      else
+      {
+        return converter_(FWD(arg));
+      }
+    }
+
+    template<direction dir>
+    constexpr void
+    assign(auto&& lhs, auto&& rhs) const
+      requires requires (converter_t& converter, context_t& context) {
+                 converter.template assign<dir>(FWD(lhs), FWD(rhs), context);
+               } || requires (converter_t& converter) {
+                      converter.template assign<dir>(FWD(lhs), FWD(rhs));
+                    }
+    {
+      if constexpr (requires { converter_.template assign<dir>(FWD(lhs), FWD(rhs), context_); })
+      {
+        converter_.template assign<dir>(FWD(lhs), FWD(rhs), context_);
+      }
+      else
+      {
+        converter_.template assign<dir>(FWD(lhs), FWD(rhs));
+      }
+    }
+
+    template<direction dir>
+    constexpr auto
+    equal(auto&& lhs, auto&& rhs) const -> bool
+      requires requires (converter_t& converter, context_t& context) {
+                 converter.template equal<dir>(FWD(lhs), FWD(rhs), context);
+               } || requires (converter_t& converter) {
+                      converter.template equal<dir>(FWD(lhs), FWD(rhs));
+                    }
+    {
+      if constexpr (requires { converter_.template equal<dir>(FWD(lhs), FWD(rhs), context_); })
+      {
+        return converter_.template equal<dir>(FWD(lhs), FWD(rhs), context_);
+      }
+      else
+      {
+        return converter_.template equal<dir>(FWD(lhs), FWD(rhs));
+      }
+    }
+
+  private:
+    converter_t& converter_; // NOLINT
+    context_t&   context_;   // NOLINT
+  };
+
+  // 'converter' bound to 'context' (see 'contextual'), except for 'identity' which never takes
+  // one, so operators keep their fast paths for it.
+  template<typename converter_t, typename context_t>
+  constexpr auto
+  bind_context(converter_t& converter, context_t& context)
+  {
+    if constexpr (std::same_as<std::remove_cv_t<converter_t>, identity>)
+    {
+      (void)context;
+      return converter;
+    }
+    else
+    {
+      return contextual<converter_t, context_t>(converter, context);
+    }
+  }
+
+  namespace details
+  {
+    template<typename str_t>
+    concept string_like = std::convertible_to<str_t const&, std::string_view>;
+
+    template<typename str_t>
+    concept assignable_string = string_like<str_t> && requires (str_t& str, std::size_t size) {
+                                                        str.resize(size);
+                                                        *std::begin(str) = char{};
+                                                      };
+
+    // Number <-> string assignment & comparison used by 'numeric_string'.
+    template<typename number_t>
+    struct numeric_chars
+    {
+      // enough for any integer (up to 128 bits) & the shortest round-trip floating point format
+      static constexpr std::size_t max_chars = 64;
+
+      using buffer_t = std::array<char, max_chars>;
+
+      static auto
+      format(number_t value, buffer_t& buffer) -> std::string_view
+      {
+        auto const [end, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        return {buffer.data(), ec == std::errc{} ? end : buffer.data()};
+      }
+
+      static auto
+      parse(std::string_view str) -> number_t
+      {
+        auto value = number_t{};
+        std::from_chars(str.data(), str.data() + str.size(), value);
+        return value;
+      }
+
+      static void
+      assign(assignable_string auto& to, std::same_as<number_t> auto from, buffer_t& buffer)
+      {
+        // cheaper than 'assign()' for short strings, & keeps the capacity all the same
+        auto const chars = format(from, buffer);
+        to.resize(chars.size());
+        std::copy(chars.begin(), chars.end(), std::begin(to));
+      }
+
+      static void
+      assign(number_t& to, string_like auto const& from, buffer_t&)
+      {
+        to = parse(from);
+      }
+
+      // bulk: range of numbers <-> range of strings
+      static void
+      assign(concepts::range auto& to, concepts::range auto const& from, buffer_t& buffer)
+        requires (!string_like<decltype(to)>) && (!string_like<decltype(from)>) &&
+                 requires { assign(*std::begin(to), *std::begin(from), buffer); }
+      {
+        if constexpr (concepts::resizable_container<decltype(to)>)
+        {
+          to.resize(std::size(from));
+        }
+        auto toItr = std::begin(to);
+        for (auto fromItr = std::begin(from); toItr != std::end(to) && fromItr != std::end(from);
+             ++toItr, ++fromItr)
+        {
+          assign(*toItr, *fromItr, buffer);
+        }
+      }
+
+      static auto
+      equal(string_like auto const& to, std::same_as<number_t> auto from, buffer_t& buffer)
+        -> bool
+      {
+        return std::string_view(to) == format(from, buffer);
+      }
+
+      static auto
+      equal(std::same_as<number_t> auto to, string_like auto const& from, buffer_t&) -> bool
+      {
+        return to == parse(from);
+      }
+    };
+  }
+
+  // Converts between numbers & their (locale independent) string representation using
+  // 'std::to_chars' & 'std::from_chars'. Strings are assigned in place (re-using their capacity)
+  // & strings not holding a number (as parsed by 'std::from_chars') convert to 0, so nothing
+  // throws. Assigning a range of numbers to a range of strings (& vice versa) is done in bulk,
+  // sharing one scratch buffer for all elements.
+  template<typename number_t>
+    requires (std::integral<number_t> || std::floating_point<number_t>) &&
+             (!std::same_as<number_t, bool>)
+  struct numeric_string
+  {
+    using chars_t  = details::numeric_chars<number_t>;
+    using buffer_t = typename chars_t::buffer_t;
+
+    auto
+    operator()(std::same_as<number_t> auto value) const -> std::string
+    {
+      auto buffer = buffer_t{};
+      return std::string(chars_t::format(value, buffer));
+    }
+
+    auto
+    operator()(details::string_like auto const& str) const -> number_t
+    {
+      return chars_t::parse(str);
+    }
+
+    template<direction dir>
+    void
+    assign(auto&& lhs, auto&& rhs) const
+      requires (dir == direction::rhs_to_lhs &&
+                requires (buffer_t buffer) { chars_t::assign(lhs, rhs, buffer); }) ||
+               (dir == direction::lhs_to_rhs &&
+                requires (buffer_t buffer) { chars_t::assign(rhs, lhs, buffer); })
+    {
+      auto buffer = buffer_t{};
+      if constexpr (dir == direction::rhs_to_lhs)
+      {
+        chars_t::assign(lhs, rhs, buffer);
+      }
+      else
+      {
+        chars_t::assign(rhs, lhs, buffer);
+      }
+    }
+
+    // Hash of the string 'value' converts to (see 'mapping::hash_rhs'), without allocating it.
+    auto
+    hash_rhs(std::same_as<number_t> auto value) const -> std::size_t
+    {
+      auto buffer = buffer_t{};
+      return std::hash<std::string_view>{}(chars_t::format(value, buffer));
+    }
+
+    template<direction dir>
+    auto
+    equal(auto const& lhs, auto const& rhs) const -> bool
+      requires (dir == direction::rhs_to_lhs &&
+                requires (buffer_t buffer) { chars_t::equal(lhs, rhs, buffer); }) ||
+               (dir == direction::lhs_to_rhs &&
+                requires (buffer_t buffer) { chars_t::equal(rhs, lhs, buffer); })
+    {
+      auto buffer = buffer_t{};
+      if constexpr (dir == direction::rhs_to_lhs)
+      {
+        return chars_t::equal(lhs, rhs, buffer);
+      }
+      else
+      {
+        return chars_t::equal(rhs, lhs, buffer);
+      }
+    }
+  };
+
+  namespace details
+  {
+    template<typename key_t>
+    concept memoizable_key = std::copy_constructible<key_t> && std::equality_comparable<key_t> &&
+                             requires (key_t const& key) {
+                               { std::hash<key_t>{}(key) } -> std::convertible_to<std::size_t>;
+                             };
+
+    // Bounded cache of key/value pairs using open addressing: an entry lives in one of the
+    // 'probe_length' slots following the one its hash maps to. When all of those are taken, one
+    // is evicted using CLOCK, ie. the first one not referenced since it was last passed over
+    // (entries are flagged as referenced when found).
+    template<typename key_t, typename value_t, std::size_t capacity>
+    class clock_cache
+    {
+    public:
+      static constexpr std::size_t slots        = std::bit_ceil(std::max(capacity, std::size_t{1}));
+      static constexpr std::size_t probe_length = std::min(slots, std::size_t{8});
+
+      static auto
+      hash(key_t const& key) -> std::size_t
+      {
+        // fibonacci hashing, since 'std::hash' is often the identity for integers
+        auto const mixed = static_cast<std::uint64_t>(std::hash<key_t>{}(key)) *
+                           std::uint64_t{0x9E3779B97F4A7C15};
+        return static_cast<std::size_t>(mixed >> 32);
+      }
+
+      auto
+      find(key_t const& key, std::size_t hash) -> value_t const*
+      {
+        for (std::size_t i = 0; i < probe_length; ++i)
+        {
+          auto const slot = (hash + i) & (slots - 1);
+          if (hashes_[slot] == hash && entries_[slot] && entries_[slot]->first == key)
+          {
+            referenced_[slot] = true;
+            return &entries_[slot]->second;
+          }
+        }
+        return nullptr;
+      }
+
+      auto
+      insert(key_t const& key, std::size_t hash, auto&& value) -> value_t const&
+      {
+        // 1. take a free slot if there is one
+        auto victim = slots;
+        for (std::size_t i = 0; i < probe_length && victim == slots; ++i)
+        {
+          auto const slot = (hash + i) & (slots - 1);
+          victim          = entries_[slot] ? victim : slot;
+        }
+        // 2. otherwise evict the first unreferenced entry (or the first entry if all are)
+        for (std::size_t i = 0; i < probe_length && victim == slots; ++i)
+        {
+          auto const slot   = (hash + i) & (slots - 1);
+          victim            = referenced_[slot] ? victim : slot;
+          referenced_[slot] = false;
+        }
+        victim = victim == slots ? hash & (slots - 1) : victim;
+
+        hashes_[victim]     = hash;
+        referenced_[victim] = false;
+        if (auto& entry = entries_[victim])
+        {
+          // re-use the storage of the evicted entry
+          entry->first  = key;
+          entry->second = FWD(value);
+          return entry->second;
+        }
+        return entries_[victim].emplace(key, FWD(value)).second;
+      }
+
+    private:
+      std::array<std::size_t, slots>                              hashes_{};
+      std::array<bool, slots>                                     referenced_{};
+      std::array<std::optional<std::pair<key_t, value_t>>, slots> entries_{};
+    };
+
+    // Caches of different types, each created on its first use (so their types needn't be known
+    // upfront). Copies hold copies of the caches.
+    class typed_caches
+    {
+    public:
+      typed_caches() = default;
+
+      typed_caches(typed_caches const& other)
+      {
+        caches_.reserve(other.caches_.size());
+        for (auto const& cache : other.caches_)
+        {
+          caches_.push_back(cache->clone());
+        }
+      }
+
+      typed_caches(typed_caches&&) noexcept = default;
+      ~typed_caches()                       = default;
+
+      auto
+      operator=(typed_caches const& other) -> typed_caches&
+      {
+        if (this != &other)
+        {
+          *this = typed_caches(other);
+        }
+        return *this;
+      }
+
+      auto operator=(typed_caches&&) noexcept -> typed_caches& = default;
+
+      template<typename cache_t>
+      auto
+      get() -> cache_t&
+      {
+        for (auto const& cache : caches_)
+        {
+          if (cache->tag == &tag_of<cache_t>)
+          {
+            return static_cast<holder<cache_t>&>(*cache).cache;
+          }
+        }
+        caches_.push_back(std::make_unique<holder<cache_t>>());
+        return static_cast<holder<cache_t>&>(*caches_.back()).cache;
+      }
+
+    private:
+      // (its address identifies 'cache_t')
+      template<typename cache_t>
+      static constexpr char tag_of{};
+
+      struct holder_base
+      {
+        explicit holder_base(void const* cacheTag)
+          : tag(cacheTag)
+        {}
+
+        holder_base(holder_base const&)                    = delete;
+        holder_base(holder_base&&)                         = delete;
+        virtual ~holder_base()                             = default;
+        auto operator=(holder_base const&) -> holder_base& = delete;
+        auto operator=(holder_base&&) -> holder_base&      = delete;
+
+        virtual auto
+        clone() const -> std::unique_ptr<holder_base> = 0;
+
+        void const* tag;
+      };
+
+      template<typename cache_t>
+      struct holder final : holder_base
+      {
+        explicit holder(cache_t value = {})
+          : holder_base(&tag_of<cache_t>)
+          , cache(std::move(value))
+        {}
+
+        auto
+        clone() const -> std::unique_ptr<holder_base> override
+        {
+          return std::make_unique<holder>(cache);
+        }
+
+        cache_t cache;
+      };
+
+      std::vector<std::unique_ptr<holder_base>> caches_;
+    };
+  }
+
+  // Caches the results of 'converter_t' per argument value, holding roughly 'capacity' entries
+  // for each (decayed) argument type it's invoked with, eg. one per direction of a mapping. Each
+  // cache is allocated on the first invocation with its type. The caches are held by value, so
+  // copies of the wrapper (eg. those of copied mappings) don't share them, but a single one must
+  // not be invoked concurrently (eg. with 'execution::par'). Results are returned by value, as a
+  // cached one may be evicted by the next invocation.
+  template<typename converter_t, std::size_t capacity>
+  struct memoized
+  {
+    memoized() = default;
+
+    explicit memoized(converter_t converter)
+      : converter_(std::move(converter))
+    {}
+
+    template<typename arg_t>
+    using result_t = std::remove_cvref_t<std::invoke_result_t<converter_t const&, arg_t const&>>;
+
+    template<typename arg_t>
+    using cache_t = details::clock_cache<arg_t, result_t<arg_t>, capacity>;
+
+    auto
+    operator()(auto&& arg) const -> result_t<std::remove_cvref_t<decltype(arg)>>
+      requires details::memoizable_key<std::remove_cvref_t<decltype(arg)>> &&
+               std::invocable<converter_t const&, std::remove_cvref_t<decltype(arg)> const&>
+    {
+      using key_t = std::remove_cvref_t<decltype(arg)>;
+
+      auto&       cache = caches_.template get<cache_t<key_t>>();
+      auto const& key   = static_cast<key_t const&>(arg);
+      auto const  hash  = cache.hash(key);
+      if (auto const* value = cache.find(key, hash))
+      {
+        return *value;
+      }
+      return cache.insert(key, hash, converter_(key));
+    }
+
+  private:
+    converter_t                   converter_;
+    mutable details::typed_caches caches_;
+  };
 }
 
 #undef FWD
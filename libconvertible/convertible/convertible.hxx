@@ -3,12 +3,18 @@
 #include <convertible/adapter.hxx>
 #include <convertible/common.hxx>
 #include <convertible/concepts.hxx>
+#include <convertible/execution.hxx>
+#include <convertible/hash.hxx>
 #include <convertible/mapping.hxx>
 #include <convertible/mapping_table.hxx>
 #include <convertible/operators.hxx>
 #include <convertible/readers.hxx>
+#include <convertible/reconcile.hxx>
+#include <convertible/simd.hxx>
 #include <convertible/std_concepts_ext.hxx>
 
+#include <tuple>
+
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
 namespace convertible
@@ -17,8 +23,22 @@ namespace convertible
   constexpr auto
   compose(adapter_ts&&... adapters)
   {
-    auto adaptee = std::get<0>(std::tuple{adapters...}).defaulted_adaptee();
-    return adapter(adaptee, reader::composed(FWD(adapters)...));
+    // keeps the outermost adapter's adaptee if it does (without copying the adapters for it)
+    using outer_t  = std::remove_cvref_t<std::tuple_element_t<0, std::tuple<adapter_ts...>>>;
+    using reader_t = reader::composed<std::remove_cvref_t<adapter_ts>...>;
+    using composed_t =
+      adapter<typename outer_t::adaptee_value_t, reader_t, typename outer_t::default_adaptee_t>;
+
+    if constexpr (std::is_empty_v<typename outer_t::default_adaptee_t>)
+    {
+      return composed_t(reader_t(FWD(adapters)...));
+    }
+    else
+    {
+      auto adaptee = [](auto const& outer, auto const&...) { return outer.defaulted_adaptee(); }(
+        adapters...);
+      return composed_t(adaptee, reader_t(FWD(adapters)...));
+    }
   }
 
   constexpr auto
@@ -60,8 +80,9 @@ namespace convertible
   constexpr auto
   member(member_ptr_t ptr, concepts::adaptable<reader::member<member_ptr_t>> auto&&... adaptee)
   {
-    return adapter<traits::member_class_t<member_ptr_t>, reader::member<member_ptr_t>>(
-      FWD(adaptee)..., FWD(ptr));
+    using class_t   = traits::member_class_t<member_ptr_t>;
+    using default_t = details::default_adaptee_t<class_t, sizeof...(adaptee) != 0>;
+    return adapter<class_t, reader::member<member_ptr_t>, default_t>(FWD(adaptee)..., FWD(ptr));
   }
 
   template<concepts::member_ptr member_ptr_t>
@@ -72,6 +93,27 @@ namespace convertible
     return compose(FWD(inner)..., member(FWD(ptr)));
   }
 
+  // 'member<&type::x>()': same as 'member(&type::x)', but with an empty (compile-time) reader.
+  template<auto ptr>
+    requires concepts::member_ptr<decltype(ptr)>
+  constexpr auto
+  member(concepts::adaptable<reader::member_constant<ptr>> auto&&... adaptee)
+  {
+    using class_t   = traits::member_class_t<decltype(ptr)>;
+    using default_t = details::default_adaptee_t<class_t, sizeof...(adaptee) != 0>;
+    return adapter<class_t, reader::member_constant<ptr>, default_t>(
+      FWD(adaptee)..., reader::member_constant<ptr>{});
+  }
+
+  template<auto ptr>
+    requires concepts::member_ptr<decltype(ptr)>
+  constexpr auto
+  member(concepts::adapter auto&&... inner)
+    requires (sizeof...(inner) > 0)
+  {
+    return compose(FWD(inner)..., member<ptr>());
+  }
+
   template<details::const_value i>
   constexpr auto
   index(concepts::adaptable<reader::index<i>> auto&&... adaptee)
@@ -125,17 +167,42 @@ namespace convertible
       FWD(pack));
   }
 
-  template<typename... mapping_ts>
+  namespace details
+  {
+    // References to what 'arg' adds to a table: its mappings if it's a table itself (ie. nested
+    // tables are spliced in rather than stored whole), otherwise 'arg'.
+    constexpr auto
+    table_entries(auto&& arg)
+    {
+      if constexpr (traits::is_mapping_table_v<decltype(arg)>)
+      {
+        return std::apply(
+          [](auto&&... mappings)
+          {
+            return std::forward_as_tuple(FWD(mappings)...);
+          },
+          FWD(arg).mappings());
+      }
+      else
+      {
+        return std::forward_as_tuple(FWD(arg));
+      }
+    }
+  }
+
+  // Table with the mappings of 'table' followed by 'mappings' (which may be tables as well). Each
+  // mapping is copied once from l-values & moved from r-values, eg. 'extend(std::move(base), ...)'.
   constexpr auto
-  extend(mapping_table<mapping_ts...> table, auto&&... mappings)
+  extend(auto&& table, auto&&... mappings)
+    requires traits::is_mapping_table_v<decltype(table)> &&
+             (concepts::mapping<decltype(mappings)> && ...)
   {
     return std::apply(
-      [&](auto&&... mappings1)
+      [](auto&&... entries)
       {
-        return mapping_table(std::forward<mapping_ts>(mappings1)...,
-                             std::forward<decltype(mappings)>(mappings)...);
+        return mapping_table(FWD(entries)...);
       },
-      table.mappings());
+      std::tuple_cat(details::table_entries(FWD(table)), details::table_entries(FWD(mappings))...));
   }
 }
 
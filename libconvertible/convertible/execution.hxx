@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace convertible::execution
+{
+  // Runs everything on the calling thread.
+  struct sequenced_policy
+  {
+    template<typename fn_t>
+    constexpr void
+    bulk(std::size_t count, fn_t&& fn) const
+    {
+      if (count > 0)
+      {
+        fn(std::size_t{0}, count);
+      }
+    }
+  };
+
+  // Splits work across up to 'concurrency' threads (the calling thread included). The converter
+  // is shared between the threads, so it must be safe to invoke concurrently.
+  struct parallel_policy
+  {
+    // number of threads to use at most
+    std::size_t concurrency = std::max(1u, std::thread::hardware_concurrency());
+    // smaller sequences are not worth splitting
+    std::size_t min_chunk = std::size_t{1} << 14;
+    // run the mappings of a mapping_table concurrently (each one on a single thread), which
+    // requires that they don't touch the same members
+    bool concurrent_mappings = false;
+
+    // Invokes 'fn(first, last)' once per chunk of [0, count) & waits for all of them to finish.
+    // The first exception thrown (if any) is rethrown on the calling thread.
+    template<typename fn_t>
+    void
+    bulk(std::size_t count, fn_t&& fn) const
+    {
+      auto const chunks =
+        std::clamp(count / std::max(min_chunk, std::size_t{1}), std::size_t{1}, concurrency);
+      if (chunks == 1)
+      {
+        if (count > 0)
+        {
+          fn(std::size_t{0}, count);
+        }
+        return;
+      }
+
+      std::exception_ptr error;
+      std::mutex         errorMutex;
+      auto               run = [&](std::size_t first, std::size_t last)
+      {
+        try
+        {
+          fn(first, last);
+        }
+        catch (...)
+        {
+          auto lock = std::scoped_lock(errorMutex);
+          if (!error)
+          {
+            error = std::current_exception();
+          }
+        }
+      };
+
+      {
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks - 1);
+
+        auto const  chunkSize = count / chunks;
+        auto const  remainder = count % chunks;
+        std::size_t first     = 0;
+        for (std::size_t i = 0; i < chunks; ++i)
+        {
+          auto const last = first + chunkSize + (i < remainder ? 1 : 0);
+          if (i + 1 < chunks)
+          {
+            workers.emplace_back(run, first, last);
+          }
+          else
+          {
+            run(first, last);
+          }
+          first = last;
+        }
+      } // join
+
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+    }
+  };
+
+  inline constexpr sequenced_policy seq{};
+  inline parallel_policy const      par{};
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <convertible/std_concepts_ext.hxx>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace convertible
+{
+  namespace details
+  {
+    constexpr auto
+    hash_combine(std::size_t seed, std::size_t value) -> std::size_t
+    {
+      // as 'boost::hash_combine'
+      return seed ^ (value + std::size_t{0x9e3779b9} + (seed << 6) + (seed >> 2));
+    }
+
+    // Combines the hashes of the elements of 'range' (as returned by 'elem_hash'), in order for
+    // sequences & regardless of order for associative containers, so that ordered & unordered
+    // ones with the same elements hash equally.
+    constexpr auto
+    hash_range(auto const& range, auto&& elem_hash) -> std::size_t
+    {
+      auto seed = std::size_t{0};
+      for (auto const& elem : range)
+      {
+        if constexpr (concepts::associative_container<std::remove_cvref_t<decltype(range)>>)
+        {
+          seed += hash_combine(0, elem_hash(elem));
+        }
+        else
+        {
+          seed = hash_combine(seed, elem_hash(elem));
+        }
+      }
+      return seed;
+    }
+
+    // Combines the hashes of 'key' & 'mapped' as 'convertible::hash' does for the elements of
+    // maps.
+    constexpr auto
+    hash_pair(std::size_t key, std::size_t mapped) -> std::size_t
+    {
+      return hash_combine(hash_combine(0, key), mapped);
+    }
+
+    template<typename value_t>
+    concept std_hashable = requires (value_t const& value) {
+                             { std::hash<value_t>{}(value) } -> std::convertible_to<std::size_t>;
+                           };
+
+    template<typename value_t>
+    concept tuple_like = requires { typename std::tuple_size<value_t>::type; };
+
+    template<typename value_t>
+    consteval auto
+    is_hashable() -> bool
+    {
+      using type = std::remove_cvref_t<value_t>;
+      if constexpr (std_hashable<type>)
+      {
+        return true;
+      }
+      else if constexpr (concepts::range<type>)
+      {
+        return is_hashable<traits::range_value_t<type>>();
+      }
+      else if constexpr (tuple_like<type>)
+      {
+        return []<std::size_t... is>(std::index_sequence<is...>)
+        {
+          return (is_hashable<std::tuple_element_t<is, type>>() && ...);
+        }(std::make_index_sequence<std::tuple_size_v<type>>{});
+      }
+      else
+      {
+        return false;
+      }
+    }
+  }
+
+  namespace concepts
+  {
+    // Hashable by 'convertible::hash'.
+    template<typename value_t>
+    concept hashable = details::is_hashable<value_t>();
+  }
+
+  // Hashes values with 'std::hash', ranges (without one) element by element (in any order for
+  // associative containers) & tuple-likes (eg. the elements of maps) member by member.
+  struct hash
+  {
+    template<concepts::hashable value_t>
+    constexpr auto
+    operator()(value_t const& value) const -> std::size_t
+    {
+      using type = std::remove_cvref_t<value_t>;
+      if constexpr (details::std_hashable<type>)
+      {
+        return std::hash<type>{}(value);
+      }
+      else if constexpr (concepts::range<type>)
+      {
+        return details::hash_range(value,
+                                   [this](auto const& elem)
+                                   {
+                                     return (*this)(elem);
+                                   });
+      }
+      else
+      {
+        return std::apply(
+          [this](auto const&... elems)
+          {
+            auto seed = std::size_t{0};
+            ((seed = details::hash_combine(seed, (*this)(elems))), ...);
+            return seed;
+          },
+          value);
+      }
+    }
+  };
+}
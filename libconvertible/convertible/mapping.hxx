@@ -1,13 +1,302 @@
 #pragma once
 
+#include <convertible/common.hxx>
 #include <convertible/concepts.hxx>
+#include <convertible/hash.hxx>
 #include <convertible/operators.hxx>
 #include <convertible/readers.hxx>
 
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
 namespace convertible
 {
+  namespace details
+  {
+    // Whether values of 'value_t' are hashed as a whole, rather than element by element through
+    // the converter (as 'operators::equal' compares them).
+    template<typename value_t>
+    concept hashed_whole = std_hashable<std::remove_cvref_t<value_t>> ||
+                           (!concepts::sequence_container<value_t> &&
+                            !concepts::mapping_container<value_t>);
+
+    // Whether 'lhs_hash' is defined for 'lhs_t' & 'converter_t'.
+    template<typename lhs_t, typename converter_t>
+    consteval auto
+    is_lhs_hashable() -> bool
+    {
+      using type = std::remove_cvref_t<lhs_t>;
+      if constexpr (requires (converter_t const& converter, type const& lhs) {
+                      { converter.hash_lhs(lhs) } -> std::convertible_to<std::size_t>;
+                    })
+      {
+        return true;
+      }
+      else if constexpr (hashed_whole<type>)
+      {
+        return concepts::hashable<type>;
+      }
+      else if constexpr (concepts::mapping_container<type>)
+      {
+        return concepts::hashable<typename type::key_type> &&
+               is_lhs_hashable<traits::mapped_value_t<type>, converter_t>();
+      }
+      else
+      {
+        return is_lhs_hashable<traits::range_value_t<type>, converter_t>();
+      }
+    }
+
+    // Whether 'rhs_hash' is defined for 'lhs_t' (or 'void' if unknown), 'rhs_t' & 'converter_t'.
+    template<typename lhs_t, typename rhs_t, typename converter_t>
+    consteval auto
+    is_rhs_hashable() -> bool
+    {
+      using lhs_type = std::remove_cvref_t<lhs_t>;
+      using rhs_type = std::remove_cvref_t<rhs_t>;
+      if constexpr (requires (converter_t const& converter, rhs_type const& rhs) {
+                      { converter.hash_rhs(rhs) } -> std::convertible_to<std::size_t>;
+                    })
+      {
+        return true;
+      }
+      else if constexpr (std::is_void_v<lhs_type>)
+      {
+        if constexpr (hashed_whole<rhs_type>)
+        {
+          if constexpr (std::invocable<converter_t const&, rhs_type const&>)
+          {
+            return concepts::hashable<traits::converted_t<converter_t const&, rhs_type const&>>;
+          }
+          else
+          {
+            return false;
+          }
+        }
+        else if constexpr (concepts::mapping_container<rhs_type>)
+        {
+          return concepts::hashable<typename rhs_type::key_type> &&
+                 is_rhs_hashable<void, traits::mapped_value_t<rhs_type>, converter_t>();
+        }
+        else
+        {
+          return is_rhs_hashable<void, traits::range_value_t<rhs_type>, converter_t>();
+        }
+      }
+      else if constexpr (hashed_whole<lhs_type>)
+      {
+        using cast_t = convertible::converter::explicit_cast<lhs_type, converter_t const>;
+        if constexpr (std::invocable<cast_t const&, rhs_type const&>)
+        {
+          return concepts::hashable<lhs_type> &&
+                 std::constructible_from<lhs_type, std::invoke_result_t<cast_t const&,
+                                                                        rhs_type const&>>;
+        }
+        else
+        {
+          return false;
+        }
+      }
+      else if constexpr (concepts::mapping_container<lhs_type> &&
+                         concepts::mapping_container<rhs_type>)
+      {
+        return concepts::hashable<typename lhs_type::key_type> &&
+               std::constructible_from<typename lhs_type::key_type,
+                                       typename rhs_type::key_type const&> &&
+               is_rhs_hashable<traits::mapped_value_t<lhs_type>, traits::mapped_value_t<rhs_type>,
+                               converter_t>();
+      }
+      else if constexpr (concepts::sequence_container<lhs_type> &&
+                         concepts::sequence_container<rhs_type>)
+      {
+        return is_rhs_hashable<traits::range_value_t<lhs_type>, traits::range_value_t<rhs_type>,
+                               converter_t>();
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    // Element types of the (lhs) container 'cont_t', or 'void' if unknown (ie. 'cont_t' is).
+    template<typename cont_t>
+    struct range_value_of
+    {
+      using type = traits::range_value_t<cont_t>;
+    };
+
+    template<>
+    struct range_value_of<void>
+    {
+      using type = void;
+    };
+
+    template<typename cont_t>
+    struct mapped_value_of
+    {
+      using type = traits::mapped_value_t<cont_t>;
+    };
+
+    template<>
+    struct mapped_value_of<void>
+    {
+      using type = void;
+    };
+
+    template<typename cont_t>
+    struct key_type_of
+    {
+      using type = typename cont_t::key_type;
+    };
+
+    template<>
+    struct key_type_of<void>
+    {
+      using type = void;
+    };
+
+    // Hash of the key of an element of a rhs map, as looked up in a lhs map with 'key_t' keys (or
+    // as is if unknown).
+    template<typename key_t>
+    constexpr auto
+    rhs_key_hash(auto const& key) -> std::size_t
+    {
+      if constexpr (std::is_void_v<key_t>)
+      {
+        return hash{}(key);
+      }
+      else
+      {
+        return hash{}(key_t(key));
+      }
+    }
+
+    // Hash of 'lhs' as compared by 'operators::equal' through 'converter' (ie. as is), or as
+    // hashed by 'converter.hash_lhs' if provided.
+    template<typename converter_t>
+    constexpr auto
+    lhs_hash(auto const& lhs, converter_t const& converter) -> std::size_t
+    {
+      using type = std::remove_cvref_t<decltype(lhs)>;
+      if constexpr (requires { converter.hash_lhs(lhs); })
+      {
+        return converter.hash_lhs(lhs);
+      }
+      else if constexpr (hashed_whole<type>)
+      {
+        return hash{}(lhs);
+      }
+      else if constexpr (concepts::mapping_container<type>)
+      {
+        return hash_range(lhs,
+                          [&converter](auto const& elem)
+                          {
+                            return hash_pair(hash{}(elem.first), lhs_hash(elem.second, converter));
+                          });
+      }
+      else
+      {
+        return hash_range(lhs,
+                          [&converter](auto const& elem)
+                          {
+                            return lhs_hash(elem, converter);
+                          });
+      }
+    }
+
+    // Hash of 'rhs' as compared by 'operators::equal' with a 'lhs_t' (ie. converted to it), or
+    // as hashed by 'converter.hash_rhs' if provided. Equals 'lhs_hash' of any equal 'lhs_t'.
+    template<typename lhs_t, typename converter_t>
+    constexpr auto
+    rhs_hash(auto const& rhs, converter_t const& converter) -> std::size_t
+    {
+      using lhs_type = std::remove_cvref_t<lhs_t>;
+      using rhs_type = std::remove_cvref_t<decltype(rhs)>;
+      if constexpr (requires { converter.hash_rhs(rhs); })
+      {
+        return converter.hash_rhs(rhs);
+      }
+      else if constexpr (std::is_void_v<lhs_type> && hashed_whole<rhs_type>)
+      {
+        return hash{}(converter(rhs));
+      }
+      else if constexpr (!std::is_void_v<lhs_type> && hashed_whole<lhs_type>)
+      {
+        using cast_t = convertible::converter::explicit_cast<lhs_type, converter_t const>;
+        return hash{}(lhs_type(cast_t(converter)(rhs)));
+      }
+      else if constexpr (concepts::mapping_container<rhs_type>)
+      {
+        return hash_range(rhs,
+                          [&converter](auto const& elem)
+                          {
+                            using key_t    = typename key_type_of<lhs_type>::type;
+                            using mapped_t = typename mapped_value_of<lhs_type>::type;
+                            return hash_pair(rhs_key_hash<key_t>(elem.first),
+                                             rhs_hash<mapped_t>(elem.second, converter));
+                          });
+      }
+      else
+      {
+        auto const elemHash = [&converter](auto const& elem)
+        {
+          using value_t = typename range_value_of<lhs_type>::type;
+          return rhs_hash<value_t>(elem, converter);
+        };
+        if constexpr (concepts::fixed_size_container<lhs_type> &&
+                      !concepts::fixed_size_container<rhs_type>)
+        {
+          // a fixed size lhs equals longer dynamic ones sharing its elements (see 'equal')
+          return hash_range(std::views::take(rhs, traits::range_size_v<lhs_type>), elemHash);
+        }
+        else
+        {
+          return hash_range(rhs, elemHash);
+        }
+      }
+    }
+  }
+
+  namespace details
+  {
+    // 'converter' bound to 'context' (see 'converter::bind_context'), or as-is without one.
+    template<typename converter_t, typename... context_ts>
+    constexpr auto
+    with_context(converter_t& converter, context_ts&... context) -> decltype(auto)
+      requires (sizeof...(context_ts) <= 1)
+    {
+      if constexpr (sizeof...(context_ts) == 0)
+      {
+        return (converter);
+      }
+      else
+      {
+        return convertible::converter::bind_context(converter, context...);
+      }
+    }
+
+    // Value type read by 'adapter_t' from its adaptee, or 'void' if it accepts any.
+    template<typename adapter_t>
+    struct adapted_value_of
+    {
+      using type = void;
+    };
+
+    template<typename adapter_t>
+      requires (!adapter_t::accepts_any_adaptee) && requires {
+        typename traits::adapted_t<adapter_t const&, typename adapter_t::adaptee_value_t const&>;
+      }
+    struct adapted_value_of<adapter_t>
+    {
+      using type = std::remove_cvref_t<
+        traits::adapted_t<adapter_t const&, typename adapter_t::adaptee_value_t const&>>;
+    };
+  }
+
   template<concepts::adapter _lhs_adapter_t, concepts::adapter _rhs_adapter_t,
            typename _converter_t = converter::identity>
   struct mapping
@@ -23,74 +312,211 @@ namespace convertible
       , converter_(std::move(converter))
     {}
 
+    // With a 'context', it's passed on to the readers & converter that accept it.
     template<direction dir>
     constexpr void
     assign(concepts::adaptable<lhs_adapter_t> auto&& lhs,
+           concepts::adaptable<rhs_adapter_t> auto&& rhs, auto&... context) const
+      requires requires (lhs_adapter_t lhsAdapter, rhs_adapter_t rhsAdapter,
+                         converter_t const& converter) {
+                 operators::assign{}.template operator()<dir>(
+                   lhsAdapter(FWD(lhs), context...), rhsAdapter(FWD(rhs), context...),
+                   details::with_context(converter, context...));
+               }
+    {
+      // the source is checked & read in one go, nothing is assigned if it's disabled
+      if constexpr (dir == direction::lhs_to_rhs)
+      {
+        lhsAdapter_.read_if(
+          FWD(lhs),
+          [this, &rhs, &context...](auto&& from)
+          {
+            operators::assign{}.template operator()<dir>(
+              FWD(from), rhsAdapter_(FWD(rhs), context...),
+              details::with_context(converter_, context...));
+          },
+          context...);
+      }
+      else
+      {
+        rhsAdapter_.read_if(
+          FWD(rhs),
+          [this, &lhs, &context...](auto&& from)
+          {
+            operators::assign{}.template operator()<dir>(
+              lhsAdapter_(FWD(lhs), context...), FWD(from),
+              details::with_context(converter_, context...));
+          },
+          context...);
+      }
+    }
+
+    template<direction dir>
+    constexpr void
+    assign(concepts::execution_policy auto const&     policy,
+           concepts::adaptable<lhs_adapter_t> auto&& lhs,
            concepts::adaptable<rhs_adapter_t> auto&& rhs) const
       requires requires (lhs_adapter_t lhsAdapter, rhs_adapter_t rhsAdapter,
-                         converter_t converter) {
-                 operators::assign{}.template operator()<dir>(lhsAdapter(FWD(lhs)),
+                         converter_t const& converter) {
+                 operators::assign{}.template operator()<dir>(policy, lhsAdapter(FWD(lhs)),
                                                               rhsAdapter(FWD(rhs)), converter);
                }
     {
-      if (dir == direction::lhs_to_rhs && !lhsAdapter_.enabled(FWD(lhs)))
+      if constexpr (dir == direction::lhs_to_rhs)
       {
-        return;
+        lhsAdapter_.read_if(FWD(lhs),
+                            [this, &policy, &rhs](auto&& from)
+                            {
+                              operators::assign{}.template operator()<dir>(
+                                policy, FWD(from), rhsAdapter_(FWD(rhs)), converter_);
+                            });
       }
-      if (dir == direction::rhs_to_lhs && !rhsAdapter_.enabled(FWD(rhs)))
+      else
       {
-        return;
+        rhsAdapter_.read_if(FWD(rhs),
+                            [this, &policy, &lhs](auto&& from)
+                            {
+                              operators::assign{}.template operator()<dir>(
+                                policy, lhsAdapter_(FWD(lhs)), FWD(from), converter_);
+                            });
       }
-      operators::assign{}.template operator()<dir>(lhsAdapter_(FWD(lhs)), rhsAdapter_(FWD(rhs)),
-                                                   converter_);
     }
 
+    // With a 'context', it's passed on to the readers & converter that accept it.
     template<direction dir = direction::rhs_to_lhs>
     constexpr auto
     equal(concepts::adaptable<lhs_adapter_t> auto&& lhs,
+          concepts::adaptable<rhs_adapter_t> auto&& rhs, auto&... context) const -> bool
+      requires requires (lhs_adapter_t lhsAdapter, rhs_adapter_t rhsAdapter,
+                         converter_t const& converter) {
+                 operators::equal{}.template operator()<dir>(
+                   lhsAdapter(FWD(lhs), context...), rhsAdapter(FWD(rhs), context...),
+                   details::with_context(converter, context...));
+               }
+    {
+      // both sides are checked & read in one go: equal if both are disabled
+      auto       ret        = false;
+      bool const lhsEnabled = lhsAdapter_.read_if(
+        FWD(lhs),
+        [this, &rhs, &ret, &context...](auto&& lhsValue)
+        {
+          rhsAdapter_.read_if(
+            FWD(rhs),
+            [this, &lhsValue, &ret, &context...](auto&& rhsValue)
+            {
+              ret = operators::equal{}.template operator()<dir>(
+                FWD(lhsValue), FWD(rhsValue), details::with_context(converter_, context...));
+            },
+            context...);
+        },
+        context...);
+      return lhsEnabled ? ret : !rhsAdapter_.enabled(FWD(rhs));
+    }
+
+    template<direction dir = direction::rhs_to_lhs>
+    auto
+    equal(concepts::execution_policy auto const&     policy,
+          concepts::adaptable<lhs_adapter_t> auto&& lhs,
           concepts::adaptable<rhs_adapter_t> auto&& rhs) const -> bool
       requires requires (lhs_adapter_t lhsAdapter, rhs_adapter_t rhsAdapter,
-                         converter_t converter) {
-                 operators::equal{}.template operator()<dir>(lhsAdapter(FWD(lhs)),
+                         converter_t const& converter) {
+                 operators::equal{}.template operator()<dir>(policy, lhsAdapter(FWD(lhs)),
                                                              rhsAdapter(FWD(rhs)), converter);
                }
     {
-      bool const lhs_enabled = lhsAdapter_.enabled(FWD(lhs));
-      bool const rhs_enabled = rhsAdapter_.enabled(FWD(rhs));
-
-      if (lhs_enabled != rhs_enabled)
-      {
-        return false;
-      }
-      else if (!lhs_enabled)
-      {
-        return true;
-      }
-
-      return operators::equal{}.template operator()<dir>(lhsAdapter_(FWD(lhs)),
-                                                         rhsAdapter_(FWD(rhs)), converter_);
+      auto       ret        = false;
+      bool const lhsEnabled = lhsAdapter_.read_if(
+        FWD(lhs),
+        [this, &policy, &rhs, &ret](auto&& lhsValue)
+        {
+          rhsAdapter_.read_if(FWD(rhs),
+                              [this, &policy, &lhsValue, &ret](auto&& rhsValue)
+                              {
+                                ret = operators::equal{}.template operator()<dir>(
+                                  policy, FWD(lhsValue), FWD(rhsValue), converter_);
+                              });
+        });
+      return lhsEnabled ? ret : !rhsAdapter_.enabled(FWD(rhs));
     }
 
     template<concepts::adaptable<rhs_adapter_t> rhs_t = typename rhs_adapter_t::adaptee_value_t>
     constexpr auto
-    operator()(concepts::adaptable<lhs_adapter_t> auto&& lhs) const
-      requires requires (rhs_t& rhs) { this->assign<direction::lhs_to_rhs>(FWD(lhs), rhs); }
+    operator()(concepts::adaptable<lhs_adapter_t> auto&& lhs, auto&... context) const
+      requires requires (rhs_t& rhs) {
+                 this->assign<direction::lhs_to_rhs>(FWD(lhs), rhs, context...);
+               }
     {
       rhs_t rhs = defaulted_rhs();
-      assign<direction::lhs_to_rhs>(FWD(lhs), rhs);
+      assign<direction::lhs_to_rhs>(FWD(lhs), rhs, context...);
       return rhs;
     }
 
     template<concepts::adaptable<lhs_adapter_t> lhs_t = typename lhs_adapter_t::adaptee_value_t>
     constexpr auto
-    operator()(concepts::adaptable<rhs_adapter_t> auto&& rhs) const
-      requires requires (lhs_t& lhs) { this->assign<direction::rhs_to_lhs>(lhs, FWD(rhs)); }
+    operator()(concepts::adaptable<rhs_adapter_t> auto&& rhs, auto&... context) const
+      requires requires (lhs_t& lhs) {
+                 this->assign<direction::rhs_to_lhs>(lhs, FWD(rhs), context...);
+               }
     {
       lhs_t lhs = defaulted_lhs();
-      assign<direction::rhs_to_lhs>(lhs, FWD(rhs));
+      assign<direction::rhs_to_lhs>(lhs, FWD(rhs), context...);
       return lhs;
     }
 
+    // Invokes 'fn' with the member read from the source of an assignment in direction 'dir',
+    // returning whether the source is enabled (nothing is assigned otherwise).
+    template<direction dir>
+    constexpr auto
+    read_source(auto const& lhs, auto const& rhs, auto&& fn) const -> bool
+      requires (dir == direction::lhs_to_rhs &&
+                concepts::adaptable<decltype(lhs), lhs_adapter_t>) ||
+               (dir == direction::rhs_to_lhs && concepts::adaptable<decltype(rhs), rhs_adapter_t>)
+    {
+      if constexpr (dir == direction::lhs_to_rhs)
+      {
+        (void)rhs;
+        return lhsAdapter_.read_if(lhs, FWD(fn));
+      }
+      else
+      {
+        (void)lhs;
+        return rhsAdapter_.read_if(rhs, FWD(fn));
+      }
+    }
+
+    // Hash of the member of 'lhs' that equals 'hash_rhs' of any 'rhs' it's 'equal' to (ie. the
+    // member of 'rhs' is hashed as converted to the lhs type), or 0 if disabled. Converters with
+    // a custom 'equal' should provide matching 'hash_lhs' & 'hash_rhs' (mappings & tables do).
+    constexpr auto
+    hash_lhs(concepts::adaptable<lhs_adapter_t> auto const& lhs) const -> std::size_t
+      requires (details::is_lhs_hashable<traits::adapted_t<lhs_adapter_t const&, decltype(lhs)>,
+                                         converter_t>())
+    {
+      auto ret = std::size_t{0};
+      lhsAdapter_.read_if(lhs,
+                          [this, &ret](auto const& value)
+                          {
+                            ret = details::lhs_hash(value, converter_);
+                          });
+      return ret;
+    }
+
+    constexpr auto
+    hash_rhs(concepts::adaptable<rhs_adapter_t> auto const& rhs) const -> std::size_t
+      requires (details::is_rhs_hashable<typename details::adapted_value_of<lhs_adapter_t>::type,
+                                         traits::adapted_t<rhs_adapter_t const&, decltype(rhs)>,
+                                         converter_t>())
+    {
+      using lhs_t = typename details::adapted_value_of<lhs_adapter_t>::type;
+      auto ret    = std::size_t{0};
+      rhsAdapter_.read_if(rhs,
+                          [this, &ret](auto const& value)
+                          {
+                            ret = details::rhs_hash<lhs_t>(value, converter_);
+                          });
+      return ret;
+    }
+
     constexpr auto
     defaulted_lhs() const
     {
@@ -104,9 +530,9 @@ namespace convertible
     }
 
   private:
-    lhs_adapter_t lhsAdapter_;
-    rhs_adapter_t rhsAdapter_;
-    converter_t   converter_;
+    CONVERTIBLE_NO_UNIQUE_ADDRESS lhs_adapter_t lhsAdapter_;
+    CONVERTIBLE_NO_UNIQUE_ADDRESS rhs_adapter_t rhsAdapter_;
+    CONVERTIBLE_NO_UNIQUE_ADDRESS converter_t   converter_;
   };
 }
 
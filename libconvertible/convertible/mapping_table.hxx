@@ -1,120 +1,551 @@
 #pragma once
 
+#include <convertible/common.hxx>
 #include <convertible/concepts.hxx>
+#include <convertible/execution.hxx>
 #include <convertible/mapping.hxx>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
 namespace convertible
 {
+  namespace details
+  {
+    // Estimated cost of comparing values of 'value_t': scalars, strings, containers, anything
+    // else (eg. nested types).
+    template<typename value_t>
+    consteval auto
+    compare_cost() -> std::size_t
+    {
+      using type = std::remove_cvref_t<value_t>;
+      if constexpr (std::is_scalar_v<type>)
+      {
+        return 0;
+      }
+      else if constexpr (std::convertible_to<type const&, std::string_view>)
+      {
+        return 1;
+      }
+      else if constexpr (concepts::range<type>)
+      {
+        return 2;
+      }
+      else
+      {
+        return 3;
+      }
+    }
+
+    // Estimated cost of comparing 'lhs_t' & 'rhs_t' with 'mapping_t', taken from the converter if
+    // it defines 'equal_cost' (eg. 'static constexpr std::size_t equal_cost = 0;'), else from the
+    // types of the members it compares (those compared by nested mappings rank last).
+    template<typename mapping_t, typename lhs_t, typename rhs_t>
+    consteval auto
+    equal_cost() -> std::size_t
+    {
+      using map_t       = std::remove_cvref_t<mapping_t>;
+      using converter_t = typename map_t::converter_t;
+      if constexpr (requires {
+                      { converter_t::equal_cost } -> std::convertible_to<std::size_t>;
+                    })
+      {
+        return converter_t::equal_cost;
+      }
+      else if constexpr (traits::is_mapping_v<converter_t>)
+      {
+        return 3;
+      }
+      else if constexpr (requires {
+                           typename traits::adapted_t<typename map_t::lhs_adapter_t const&, lhs_t>;
+                           typename traits::adapted_t<typename map_t::rhs_adapter_t const&, rhs_t>;
+                         })
+      {
+        return std::max(
+          compare_cost<traits::adapted_t<typename map_t::lhs_adapter_t const&, lhs_t>>(),
+          compare_cost<traits::adapted_t<typename map_t::rhs_adapter_t const&, rhs_t>>());
+      }
+      else
+      {
+        return 3;
+      }
+    }
+  }
+
+  namespace details
+  {
+    // 'mapping_t' can hash 'lhs_t', or doesn't apply to it.
+    template<typename mapping_t, typename lhs_t>
+    concept lhs_hashable_by =
+      !concepts::adaptable<lhs_t, typename std::remove_cvref_t<mapping_t>::lhs_adapter_t> ||
+      requires (mapping_t const& map, lhs_t const& lhs) { map.hash_lhs(lhs); };
+
+    // 'mapping_t' can hash 'rhs_t', or doesn't apply to it.
+    template<typename mapping_t, typename rhs_t>
+    concept rhs_hashable_by =
+      !concepts::adaptable<rhs_t, typename std::remove_cvref_t<mapping_t>::rhs_adapter_t> ||
+      requires (mapping_t const& map, rhs_t const& rhs) { map.hash_rhs(rhs); };
+  }
+
+  namespace details
+  {
+    // Source members that incremental assignments can compare to their last copy.
+    template<typename value_t>
+    concept trackable =
+      std::copy_constructible<value_t> && std::equality_comparable<value_t> &&
+      concepts::hashable<value_t>;
+
+    // (members that can't be tracked, so are always assigned)
+    struct untracked
+    {};
+
+    // Member read by 'adapter_t' from a 'source_t', as copied by incremental assignments.
+    template<typename adapter_t, typename source_t>
+    struct tracked_value
+    {
+      using type = untracked;
+    };
+
+    template<typename adapter_t, typename source_t>
+      requires requires { typename traits::adapted_t<adapter_t const&, source_t const&>; } &&
+               trackable<
+                 std::remove_cvref_t<traits::adapted_t<adapter_t const&, source_t const&>>>
+    struct tracked_value<adapter_t, source_t>
+    {
+      using type = std::remove_cvref_t<traits::adapted_t<adapter_t const&, source_t const&>>;
+    };
+
+    // Type of the source of an assignment in direction 'dir'.
+    template<direction dir, typename lhs_t, typename rhs_t>
+    using source_type_t =
+      std::remove_cvref_t<std::conditional_t<dir == direction::lhs_to_rhs, lhs_t, rhs_t>>;
+
+    template<direction dir, typename mapping_t, typename source_t>
+    using tracked_value_t =
+      typename tracked_value<std::conditional_t<dir == direction::lhs_to_rhs,
+                                                typename mapping_t::lhs_adapter_t,
+                                                typename mapping_t::rhs_adapter_t>,
+                             source_t>::type;
+  }
+
+  // State of incremental assignments in direction 'dir' from 'source_t' objects (see
+  // 'mapping_table::assign_changed'): the target & a copy (& the hash) of the source member of
+  // each mapping as of the last one.
+  template<direction dir, typename source_t, concepts::mapping... mapping_ts>
+  struct change_tracker
+  {
+    void const*                                    target = nullptr;
+    std::array<std::size_t, sizeof...(mapping_ts)> hashes{};
+    std::tuple<std::optional<details::tracked_value_t<dir, mapping_ts, source_t>>...> snapshots;
+
+    // Forgets all source members, eg. after the target was modified by other means.
+    void
+    reset()
+    {
+      target    = nullptr;
+      snapshots = {};
+    }
+  };
+
   template<concepts::mapping... mapping_ts>
   struct mapping_table
   {
+    template<direction dir, typename source_t>
+    using change_tracker_t = change_tracker<dir, source_t, mapping_ts...>;
+    // one bit per mapping (in declaration order), see 'diff' & 'assign_masked'
+    using mask_t = std::bitset<sizeof...(mapping_ts)>;
+
     using lhs_unique_types =
       traits::unique_derived_ts<typename mapping_ts::lhs_adapter_t::adaptee_value_t...>;
     using rhs_unique_types =
       traits::unique_derived_ts<typename mapping_ts::rhs_adapter_t::adaptee_value_t...>;
 
+    // One default object per distinct adaptee type: value-initialized, unless a mapping keeps the
+    // adaptee it was given (see 'adapter::defaulted_adaptee').
     constexpr auto
     defaulted_lhs() const -> lhs_unique_types
     {
-      lhs_unique_types rets;
-      for_each(
-        [this](auto&& lhs)
+      return kept_adaptees<lhs_unique_types>(
+        [](auto const& map)
         {
-          using lhs_t = std::remove_reference_t<decltype(lhs)>;
-          for_each(
-            [&lhs](auto&& mapping)
-            {
-              using defaulted_lhs_t = decltype(mapping.defaulted_lhs());
-              if constexpr (std::is_same_v<defaulted_lhs_t, lhs_t>)
-              {
-                lhs = mapping.defaulted_lhs();
-              }
-              return true;
-            },
-            mappings_);
-          return true;
-        },
-        rets);
-      return rets;
+          using adapter_t = typename std::remove_cvref_t<decltype(map)>::lhs_adapter_t;
+          if constexpr (!std::is_empty_v<typename adapter_t::default_adaptee_t>)
+          {
+            return map.defaulted_lhs();
+          }
+        });
     }
 
     constexpr auto
     defaulted_rhs() const -> rhs_unique_types
     {
-      rhs_unique_types rets;
-      for_each(
-        [this](auto&& rhs)
+      return kept_adaptees<rhs_unique_types>(
+        [](auto const& map)
         {
-          using rhs_t = std::remove_reference_t<decltype(rhs)>;
-          for_each(
-            [&rhs](auto&& mapping)
-            {
-              using defaulted_rhs_t = decltype(mapping.defaulted_rhs());
-              if constexpr (std::is_same_v<defaulted_rhs_t, rhs_t>)
-              {
-                rhs = mapping.defaulted_rhs();
-              }
-              return true;
-            },
-            mappings_);
-          return true;
-        },
-        rets);
-      return rets;
+          using adapter_t = typename std::remove_cvref_t<decltype(map)>::rhs_adapter_t;
+          if constexpr (!std::is_empty_v<typename adapter_t::default_adaptee_t>)
+          {
+            return map.defaulted_rhs();
+          }
+        });
     }
 
     constexpr explicit mapping_table(mapping_ts... mappings)
       : mappings_(std::move(mappings)...)
     {}
 
+    // With a 'context' (eg. an arena, scratch buffers or a statistics sink), it's passed on to the
+    // readers & converters that accept it (see 'converter::contextual').
+    template<direction dir, typename lhs_t, typename rhs_t, typename... context_ts>
+    constexpr void
+    assign(lhs_t&& lhs, rhs_t&& rhs, context_ts&... context) const
+      requires (!concepts::execution_policy<lhs_t>) &&
+               (concepts::mappable_assign<mapping_ts, lhs_t, rhs_t, dir, context_ts...> || ...)
+    {
+      for_each(
+        [&lhs, &rhs, &context...](concepts::mapping auto&& map)
+        {
+          if constexpr (concepts::mappable_assign<decltype(map), lhs_t, rhs_t, dir, context_ts...>)
+          {
+            map.template assign<dir>(std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs),
+                                     context...);
+          }
+          return true;
+        },
+        mappings_);
+    }
+
+    template<direction dir = direction::rhs_to_lhs, typename... context_ts>
+    constexpr auto
+    equal(auto const& lhs, auto const& rhs, context_ts&... context) const -> bool
+      requires (!concepts::execution_policy<decltype(lhs)>) &&
+               (concepts::mappable_equal<mapping_ts, decltype(lhs), decltype(rhs),
+                                         direction::rhs_to_lhs, context_ts...> ||
+                ...)
+    {
+      return for_each_by_equal_cost<decltype(lhs), decltype(rhs)>(
+        [&lhs, &rhs, &context...](concepts::mapping auto&& map) -> bool
+        {
+          if constexpr (concepts::mappable_equal<decltype(map), decltype(lhs), decltype(rhs),
+                                                 direction::rhs_to_lhs, context_ts...>)
+          {
+            return map.equal(lhs, rhs, context...);
+          }
+          else
+          {
+            return true;
+          }
+        });
+    }
+
+    // Same as 'assign', but only for the mappings set in 'mask' (eg. as returned by 'diff').
     template<direction dir, typename lhs_t, typename rhs_t>
     constexpr void
-    assign(lhs_t&& lhs, rhs_t&& rhs) const
+    assign_masked(lhs_t&& lhs, rhs_t&& rhs, mask_t const& mask) const
       requires (concepts::mappable_assign<mapping_ts, lhs_t, rhs_t, dir> || ...)
     {
+      std::size_t index = 0;
       for_each(
-        [&lhs, &rhs](concepts::mapping auto&& map)
+        [&lhs, &rhs, &mask, &index](concepts::mapping auto&& map)
         {
           if constexpr (concepts::mappable_assign<decltype(map), lhs_t, rhs_t, dir>)
           {
-            map.template assign<dir>(std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs));
+            if (mask[index])
+            {
+              map.template assign<dir>(std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs));
+            }
           }
+          ++index;
           return true;
         },
         mappings_);
     }
 
+    // Returns the mappings (one bit each, see 'mask_t') for which 'lhs' & 'rhs' differ, so only
+    // those need to be assigned. Mappings that can't compare them (but may assign them) are
+    // considered different.
     template<direction dir = direction::rhs_to_lhs>
     constexpr auto
-    equal(auto const& lhs, auto const& rhs) const -> bool
+    diff(auto const& lhs, auto const& rhs) const -> mask_t
+      requires (concepts::mappable_equal<mapping_ts, decltype(lhs), decltype(rhs), dir> || ...)
+    {
+      auto        mask  = mask_t{};
+      std::size_t index = 0;
+      for_each(
+        [&lhs, &rhs, &mask, &index](concepts::mapping auto&& map)
+        {
+          if constexpr (concepts::mappable_equal<decltype(map), decltype(lhs), decltype(rhs), dir>)
+          {
+            mask[index] = !map.template equal<dir>(lhs, rhs);
+          }
+          else
+          {
+            mask[index] = true;
+          }
+          ++index;
+          return true;
+        },
+        mappings_);
+      return mask;
+    }
+
+    // Hash of 'lhs' that equals 'hash_rhs' of any 'rhs' it's 'equal' to, so the table can serve
+    // as key function of a hash index over both sides (see 'mapping::hash_lhs'). Mappings that
+    // don't apply to 'lhs' are skipped.
+    constexpr auto
+    hash_lhs(auto const& lhs) const -> std::size_t
+      requires (traits::adaptable_count_v<decltype(lhs), typename mapping_ts::lhs_adapter_t...> >
+                0) &&
+               (details::lhs_hashable_by<mapping_ts, decltype(lhs)> && ...)
+    {
+      auto seed = std::size_t{0};
+      for_each(
+        [&lhs, &seed](concepts::mapping auto&& map)
+        {
+          using lhs_adapter_t = typename std::remove_cvref_t<decltype(map)>::lhs_adapter_t;
+          if constexpr (concepts::adaptable<decltype(lhs), lhs_adapter_t>)
+          {
+            seed = details::hash_combine(seed, map.hash_lhs(lhs));
+          }
+          return true;
+        },
+        mappings_);
+      return seed;
+    }
+
+    // Hash of 'rhs' that equals 'hash_lhs' of any 'lhs' it's 'equal' to.
+    constexpr auto
+    hash_rhs(auto const& rhs) const -> std::size_t
+      requires (traits::adaptable_count_v<decltype(rhs), typename mapping_ts::rhs_adapter_t...> >
+                0) &&
+               (details::rhs_hashable_by<mapping_ts, decltype(rhs)> && ...)
+    {
+      auto seed = std::size_t{0};
+      for_each(
+        [&rhs, &seed](concepts::mapping auto&& map)
+        {
+          using rhs_adapter_t = typename std::remove_cvref_t<decltype(map)>::rhs_adapter_t;
+          if constexpr (concepts::adaptable<decltype(rhs), rhs_adapter_t>)
+          {
+            seed = details::hash_combine(seed, map.hash_rhs(rhs));
+          }
+          return true;
+        },
+        mappings_);
+      return seed;
+    }
+
+    // Same as 'assign', but skips the mappings whose source member is unchanged since the last
+    // call with 'tracker' into the same target. A copy of each source member is kept to tell:
+    // differing hashes tell it changed, else it's compared to the copy. Mappings with source
+    // members that can't be copied, compared or hashed are always assigned. 'tracker' must be
+    // reset if the target is modified by other means in between.
+    template<direction dir, typename lhs_t, typename rhs_t>
+    void
+    assign_changed(lhs_t&& lhs, rhs_t&& rhs,
+                   change_tracker_t<dir, details::source_type_t<dir, lhs_t, rhs_t>>& tracker) const
+      requires (concepts::mappable_assign<mapping_ts, lhs_t, rhs_t, dir> || ...)
+    {
+      void const* target = nullptr;
+      if constexpr (dir == direction::rhs_to_lhs)
+      {
+        target = std::addressof(lhs);
+      }
+      else
+      {
+        target = std::addressof(rhs);
+      }
+      if (tracker.target != target)
+      {
+        tracker.reset();
+        tracker.target = target;
+      }
+
+      [&]<std::size_t... is>(std::index_sequence<is...>)
+      {
+        (assign_changed_at<is, dir>(std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs), tracker),
+         ...);
+      }(std::make_index_sequence<sizeof...(mapping_ts)>{});
+    }
+
+    // Each mapping splits its (sequence) assignment according to 'policy', or, if requested by a
+    // parallel policy, the mappings themselves are run concurrently.
+    template<direction dir, concepts::execution_policy policy_t, typename lhs_t, typename rhs_t>
+    void
+    assign(policy_t const& policy, lhs_t&& lhs, rhs_t&& rhs) const
+      requires (concepts::mappable_assign<mapping_ts, lhs_t, rhs_t, dir> || ...)
+    {
+      if constexpr (std::same_as<policy_t, execution::parallel_policy>)
+      {
+        if (policy.concurrent_mappings)
+        {
+          for_each_concurrent(policy,
+                              [&lhs, &rhs](concepts::mapping auto&& map)
+                              {
+                                if constexpr (concepts::mappable_assign<decltype(map), lhs_t,
+                                                                        rhs_t, dir>)
+                                {
+                                  map.template assign<dir>(std::forward<lhs_t>(lhs),
+                                                           std::forward<rhs_t>(rhs));
+                                }
+                              });
+          return;
+        }
+      }
+
+      for_each(
+        [&policy, &lhs, &rhs](concepts::mapping auto&& map)
+        {
+          if constexpr (concepts::mappable_assign<decltype(map), lhs_t, rhs_t, dir>)
+          {
+            map.template assign<dir>(policy, std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs));
+          }
+          return true;
+        },
+        mappings_);
+    }
+
+    // Each mapping splits its (sequence) comparison according to 'policy', or, if requested by a
+    // parallel policy, the mappings themselves are run concurrently. Either way the first mismatch
+    // stops the remaining work.
+    template<direction dir = direction::rhs_to_lhs, concepts::execution_policy policy_t>
+    auto
+    equal(policy_t const& policy, auto const& lhs, auto const& rhs) const -> bool
       requires (
         concepts::mappable_equal<mapping_ts, decltype(lhs), decltype(rhs), direction::rhs_to_lhs> ||
         ...)
     {
-      return for_each(
-        [&lhs, &rhs](concepts::mapping auto&& map) -> bool
+      if constexpr (std::same_as<policy_t, execution::parallel_policy>)
+      {
+        if (policy.concurrent_mappings)
+        {
+          auto mismatch = std::atomic<bool>{false};
+          for_each_concurrent(policy,
+                              [&lhs, &rhs, &mismatch](concepts::mapping auto&& map)
+                              {
+                                if constexpr (concepts::mappable_equal<decltype(map),
+                                                                       decltype(lhs), decltype(rhs),
+                                                                       direction::rhs_to_lhs>)
+                                {
+                                  if (!mismatch.load(std::memory_order_relaxed) &&
+                                      !map.equal(lhs, rhs))
+                                  {
+                                    mismatch.store(true, std::memory_order_relaxed);
+                                  }
+                                }
+                              });
+          return !mismatch.load();
+        }
+      }
+
+      return for_each_by_equal_cost<decltype(lhs), decltype(rhs)>(
+        [&policy, &lhs, &rhs](concepts::mapping auto&& map) -> bool
         {
           if constexpr (concepts::mappable_equal<decltype(map), decltype(lhs), decltype(rhs),
                                                  direction::rhs_to_lhs>)
           {
-            return map.equal(lhs, rhs);
+            return map.equal(policy, lhs, rhs);
           }
           else
           {
             return true;
           }
-        },
-        mappings_);
+        });
+    }
+
+    // Assigns 'rhs[i]' to 'lhs[i]' (or vice versa) for each record in the smaller of the spans.
+    template<direction dir, traversal order = traversal::row_wise, typename lhs_t,
+             std::size_t lhs_extent, typename rhs_t, std::size_t rhs_extent>
+    constexpr void
+    assign_batch(std::span<lhs_t, lhs_extent> lhs, std::span<rhs_t, rhs_extent> rhs) const
+      requires (concepts::mappable_assign<mapping_ts, lhs_t&, rhs_t&, dir> || ...)
+    {
+      auto const size = std::min(lhs.size(), rhs.size());
+      if constexpr (order == traversal::row_wise)
+      {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+          assign<dir>(lhs[i], rhs[i]);
+        }
+      }
+      else
+      {
+        for_each(
+          [lhs, rhs, size](concepts::mapping auto&& map)
+          {
+            if constexpr (concepts::mappable_assign<decltype(map), lhs_t&, rhs_t&, dir>)
+            {
+              for (std::size_t i = 0; i < size; ++i)
+              {
+                map.template assign<dir>(lhs[i], rhs[i]);
+              }
+            }
+            return true;
+          },
+          mappings_);
+      }
+    }
+
+    // Returns 'equal(lhs[i], rhs[i])' for each record in the smaller of the spans.
+    template<direction dir = direction::rhs_to_lhs, traversal order = traversal::row_wise,
+             typename lhs_t, std::size_t lhs_extent, typename rhs_t, std::size_t rhs_extent>
+    constexpr auto
+    equal_batch(std::span<lhs_t, lhs_extent> lhs, std::span<rhs_t, rhs_extent> rhs) const
+      -> std::vector<bool>
+      requires (concepts::mappable_equal<mapping_ts, lhs_t const&, rhs_t const&,
+                                         direction::rhs_to_lhs> ||
+                ...)
+    {
+      auto const size = std::min(lhs.size(), rhs.size());
+      auto       rets = std::vector<bool>(size, true);
+      if constexpr (order == traversal::row_wise)
+      {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+          rets[i] = equal<dir>(lhs[i], rhs[i]);
+        }
+      }
+      else
+      {
+        for_each_by_equal_cost<lhs_t const&, rhs_t const&>(
+          [&lhs, &rhs, &rets, size](concepts::mapping auto&& map)
+          {
+            if constexpr (concepts::mappable_equal<decltype(map), lhs_t const&, rhs_t const&,
+                                                   direction::rhs_to_lhs>)
+            {
+              for (std::size_t i = 0; i < size; ++i)
+              {
+                // records that already differ are skipped
+                if (rets[i])
+                {
+                  rets[i] = map.equal(lhs[i], rhs[i]);
+                }
+              }
+            }
+            return true;
+          });
+      }
+      return rets;
     }
 
-    template<typename lhs_t, typename result_t = rhs_unique_types>
+    template<typename lhs_t, typename... context_ts>
       requires (concepts::adaptee_type_known<typename mapping_ts::rhs_adapter_t> || ...) &&
                (traits::adaptable_count_v<lhs_t, typename mapping_ts::lhs_adapter_t...> >
                 traits::adaptable_count_v<lhs_t, typename mapping_ts::rhs_adapter_t...>)
     constexpr auto
-    operator()(lhs_t&& lhs) const
+    operator()(lhs_t&& lhs, context_ts&... context) const
     {
       auto rets = defaulted_rhs();
 
@@ -122,32 +553,28 @@ namespace convertible
         [&](auto&& rhs) -> bool
         {
           constexpr auto ok = requires {
-                                { assign<direction::lhs_to_rhs>(std::forward<lhs_t>(lhs), rhs) };
+                                {
+                                  assign<direction::lhs_to_rhs>(std::forward<lhs_t>(lhs), rhs,
+                                                                context...)
+                                };
                               };
           if constexpr (ok)
           {
-            assign<direction::lhs_to_rhs>(std::forward<lhs_t>(lhs), rhs);
+            assign<direction::lhs_to_rhs>(std::forward<lhs_t>(lhs), rhs, context...);
           }
           return true;
         },
         FWD(rets));
 
-      if constexpr (std::tuple_size_v<result_t> == 1)
-      {
-        return std::get<0>(rets);
-      }
-      else
-      {
-        return rets;
-      }
+      return single_or_tuple(std::move(rets));
     }
 
-    template<typename rhs_t, typename result_t = lhs_unique_types>
+    template<typename rhs_t, typename... context_ts>
       requires (concepts::adaptee_type_known<typename mapping_ts::lhs_adapter_t> || ...) &&
                (traits::adaptable_count_v<rhs_t, typename mapping_ts::lhs_adapter_t...> <
                 traits::adaptable_count_v<rhs_t, typename mapping_ts::rhs_adapter_t...>)
     constexpr auto
-    operator()(rhs_t&& rhs) const
+    operator()(rhs_t&& rhs, context_ts&... context) const
     {
       auto rets = defaulted_lhs();
 
@@ -155,34 +582,177 @@ namespace convertible
         [&](auto&& lhs) -> bool
         {
           constexpr auto ok = requires {
-                                { assign<direction::rhs_to_lhs>(lhs, std::forward<rhs_t>(rhs)) };
+                                {
+                                  assign<direction::rhs_to_lhs>(lhs, std::forward<rhs_t>(rhs),
+                                                                context...)
+                                };
                               };
           if constexpr (ok)
           {
-            assign<direction::rhs_to_lhs>(lhs, std::forward<rhs_t>(rhs));
+            assign<direction::rhs_to_lhs>(lhs, std::forward<rhs_t>(rhs), context...);
           }
           return true;
         },
         FWD(rets));
 
-      if constexpr (std::tuple_size_v<result_t> == 1)
+      return single_or_tuple(std::move(rets));
+    }
+
+    constexpr auto
+    mappings() const& -> std::tuple<mapping_ts...> const&
+    {
+      return mappings_;
+    }
+
+    // (lets 'extend' move the mappings out of a table it's done with)
+    constexpr auto
+    mappings() && -> std::tuple<mapping_ts...>&&
+    {
+      return std::move(mappings_);
+    }
+
+    // Order in which 'equal' visits the mappings (indices into 'mappings()'): cheapest first by
+    // their estimated cost (see 'details::equal_cost'), otherwise in declaration order.
+    template<typename lhs_t, typename rhs_t>
+    static consteval auto
+    equal_order() -> std::array<std::size_t, sizeof...(mapping_ts)>
+    {
+      constexpr auto costs = std::array<std::size_t, sizeof...(mapping_ts)>{
+        details::equal_cost<mapping_ts, lhs_t, rhs_t>()...};
+
+      auto order = std::array<std::size_t, sizeof...(mapping_ts)>{};
+      for (std::size_t i = 0; i < order.size(); ++i)
+      {
+        // (stable) insertion sort
+        auto pos = i;
+        for (; pos > 0 && costs[order[pos - 1]] > costs[i]; --pos)
+        {
+          order[pos] = order[pos - 1];
+        }
+        order[pos] = i;
+      }
+      return order;
+    }
+
+  private:
+    // The only element of 'rets' (moved out of the local tuple, else the result is copied member
+    // by member), or 'rets' itself if there are several.
+    template<typename... ts>
+    static constexpr auto
+    single_or_tuple(std::tuple<ts...>&& rets)
+    {
+      if constexpr (sizeof...(ts) == 1)
       {
-        return std::get<0>(rets);
+        return std::get<0>(std::move(rets));
       }
       else
       {
-        return rets;
+        return std::move(rets);
       }
     }
 
+    // 'rets' value-initialized, each replaced by the adaptee of its type returned by 'kept' for a
+    // mapping (the last one), if any.
+    template<typename rets_t>
     constexpr auto
-    mappings() const
+    kept_adaptees(auto const& kept) const -> rets_t
     {
-      return mappings_;
+      rets_t rets;
+      for_each(
+        [this, &kept](auto& ret)
+        {
+          for_each(
+            [&ret, &kept](concepts::mapping auto const& map)
+            {
+              if constexpr (std::same_as<decltype(kept(map)), std::remove_cvref_t<decltype(ret)>>)
+              {
+                ret = kept(map);
+              }
+              return true;
+            },
+            mappings_);
+          return true;
+        },
+        rets);
+      return rets;
     }
 
-  private:
-    std::tuple<mapping_ts...> mappings_;
+    // 'assign_changed' of the mapping at 'index'.
+    template<std::size_t index, direction dir, typename lhs_t, typename rhs_t>
+    void
+    assign_changed_at(lhs_t&& lhs, rhs_t&& rhs, auto& tracker) const
+    {
+      auto const& map = std::get<index>(mappings_);
+      if constexpr (concepts::mappable_assign<decltype(map), lhs_t, rhs_t, dir>)
+      {
+        auto& snapshot  = std::get<index>(tracker.snapshots);
+        using tracked_t = typename std::remove_reference_t<decltype(snapshot)>::value_type;
+
+        if constexpr (std::same_as<tracked_t, details::untracked>)
+        {
+          map.template assign<dir>(std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs));
+        }
+        else
+        {
+          bool const enabled = map.template read_source<dir>(
+            lhs, rhs,
+            [&](tracked_t const& source)
+            {
+              // differing hashes tell it changed without comparing
+              auto const hash = convertible::hash{}(source);
+              if (!snapshot || tracker.hashes[index] != hash || !(*snapshot == source))
+              {
+                map.template assign<dir>(std::forward<lhs_t>(lhs), std::forward<rhs_t>(rhs));
+                tracker.hashes[index] = hash;
+                snapshot.emplace(source);
+              }
+            });
+          if (!enabled)
+          {
+            // nothing is assigned from a disabled source, so the target member is unknown
+            snapshot.reset();
+          }
+        }
+      }
+    }
+
+    // Invokes 'fn' for each mapping in 'equal_order' until it returns false.
+    template<typename lhs_t, typename rhs_t>
+    constexpr auto
+    for_each_by_equal_cost(auto&& fn) const -> bool
+    {
+      return [this, &fn]<std::size_t... is>(std::index_sequence<is...>)
+      {
+        constexpr auto order = equal_order<lhs_t, rhs_t>();
+        return (fn(std::get<order[is]>(mappings_)) && ...);
+      }(std::make_index_sequence<sizeof...(mapping_ts)>{});
+    }
+
+    // Invokes 'fn' for each mapping, with the mappings split across 'policy.concurrency' threads.
+    void
+    for_each_concurrent(execution::parallel_policy const& policy, auto&& fn) const
+    {
+      auto const tasks =
+        execution::parallel_policy{.concurrency = policy.concurrency, .min_chunk = 1};
+      tasks.bulk(sizeof...(mapping_ts),
+                 [this, &fn](std::size_t first, std::size_t last)
+                 {
+                   std::size_t index = 0;
+                   for_each(
+                     [&](concepts::mapping auto&& map)
+                     {
+                       if (index >= first && index < last)
+                       {
+                         fn(map);
+                       }
+                       ++index;
+                       return true;
+                     },
+                     mappings_);
+                 });
+    }
+
+    CONVERTIBLE_NO_UNIQUE_ADDRESS std::tuple<mapping_ts...> mappings_;
   };
 }
 
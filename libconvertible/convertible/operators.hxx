@@ -2,10 +2,18 @@
 
 #include <convertible/concepts.hxx>
 #include <convertible/converters.hxx>
+#include <convertible/execution.hxx>
+#include <convertible/simd.hxx>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 #define FWD(...) ::std::forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
 
@@ -13,95 +21,10 @@ namespace convertible::operators
 {
   namespace details
   {
+    // 'converter_t' may be a reference (converters are passed by reference through all levels).
     template<typename to_t, typename converter_t>
-    using explicit_cast = converter::explicit_cast<std::remove_reference_t<to_t>, converter_t>;
-
-    template<concepts::associative_container                                 container_t,
-             std::common_reference_with<traits::mapped_value_t<container_t>> mapped_forward_t>
-    struct associative_inserter
-    {
-      using key_t             = typename container_t::key_type;
-      using value_t           = typename container_t::value_type;
-      using reference_t       = typename container_t::reference;
-      using const_reference_t = typename container_t::const_reference;
-      using mapped_value_t    = traits::mapped_value_t<container_t>;
-      using inserter_t        = std::insert_iterator<container_t>;
-
-      template<std::common_reference_with<key_t> _key_t, typename _mapped_t>
-      associative_inserter(concepts::associative_container auto&& cont,
-                           std::pair<_key_t, _mapped_t> const&    pair)
-        : cont_(cont)
-        , inserter_(cont, std::begin(cont))
-        , key_(pair.first)
-      {}
-
-      associative_inserter(concepts::associative_container auto&& cont, key_t const& key)
-        : cont_(cont)
-        , inserter_(cont, std::begin(cont))
-        , key_(key)
-      {}
-
-      [[nodiscard]] auto
-      has_value() const -> bool
-      {
-        return cont_.contains(key_);
-      }
-
-      operator mapped_forward_t()
-        requires (!std::is_const_v<container_t>)
-      {
-        if constexpr (concepts::mapping_container<container_t>)
-        {
-          return std::forward<mapped_forward_t>(cont_[key_]);
-        }
-        else
-        {
-          return std::forward<mapped_forward_t>(*cont_.find(key_));
-        }
-      }
-
-      operator mapped_forward_t() const
-        requires std::is_const_v<container_t>
-      {
-        if constexpr (concepts::mapping_container<container_t>)
-        {
-          return std::forward<mapped_forward_t>(cont_.at(key_));
-        }
-        else
-        {
-          return std::forward<mapped_forward_t>(*cont_.find(key_));
-        }
-      }
-
-      auto
-      operator=(auto&& value) -> auto&
-        requires concepts::mapping_container<container_t>
-                 // Workaround bug with apple-clang & using 'this->' in requires clause.
-                 && requires (inserter_t inserter, key_t key) { inserter = {key, FWD(value)}; }
-      {
-        inserter_ = {key_, FWD(value)};
-        return *this;
-      }
-
-      auto
-      operator=(auto&& value) -> auto&
-        requires (!concepts::mapping_container<container_t>) &&
-                 requires (inserter_t inserter) { inserter = FWD(value); }
-      {
-        inserter_ = FWD(value);
-        return *this;
-      }
-
-    private:
-      container_t&                                                                 cont_; // NOLINT
-      inserter_t                                                                   inserter_;
-      std::conditional_t<concepts::mapping_container<container_t>, key_t, value_t> key_;
-    };
-
-    template<concepts::associative_container cont_t>
-    associative_inserter(cont_t&& cont, auto&&)
-      -> associative_inserter<std::remove_reference_t<decltype(cont)>,
-                              traits::like_t<decltype(cont), traits::mapped_value_t<cont_t>>>;
+    using explicit_cast = converter::explicit_cast<std::remove_reference_t<to_t>,
+                                                   std::remove_reference_t<converter_t>>;
 
     template<direction dir>
     inline constexpr auto
@@ -131,7 +54,7 @@ namespace convertible::operators
     concept equality_comparable_with_converted =
       (concepts::equality_comparable_with_converted<
          dir, lhs_t, rhs_t, explicit_cast<traits::lhs_t<dir, lhs_t, rhs_t>, converter_t>> ||
-       requires (lhs_t&& lhs, rhs_t&& rhs, converter_t converter) {
+       requires (lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter) {
          converter.template equal<dir>(FWD(lhs), FWD(rhs));
        });
 
@@ -155,19 +78,303 @@ namespace convertible::operators
         op.template operator()<dir>(FWD(lhs), FWD(rhs), FWD(converter));
       };
 #endif
+
+    // Both sides store the same trivially copyable element type contiguously, so (with no
+    // conversion involved) the elements can be copied as raw bytes in one go.
+    template<typename lhs_t, typename rhs_t, typename converter_t>
+    concept bulk_copyable =
+      std::same_as<std::remove_cvref_t<converter_t>, converter::identity> &&
+      concepts::contiguous_container<lhs_t> && concepts::contiguous_container<rhs_t> &&
+      std::same_as<std::remove_cv_t<traits::range_value_t<lhs_t>>,
+                   std::remove_cv_t<traits::range_value_t<rhs_t>>> &&
+      concepts::trivially_copyable<traits::range_value_t<lhs_t>>;
+
+    // Both sides store (different) arithmetic element types contiguously & a vectorized kernel
+    // exists for the conversion (see 'simd::convert').
+    template<typename to_t, typename from_t, typename converter_t>
+    concept bulk_convertible =
+      std::same_as<std::remove_cvref_t<converter_t>, converter::identity> &&
+      concepts::contiguous_container<to_t> && concepts::contiguous_container<from_t> &&
+      simd::vectorizable<traits::range_value_t<from_t>, traits::range_value_t<to_t>>;
+
+    // Both sides store the same element type contiguously & equality of the elements is
+    // equivalent to comparing their bytes.
+    template<typename lhs_t, typename rhs_t, typename converter_t>
+    concept bulk_bitwise_comparable =
+      std::same_as<std::remove_cvref_t<converter_t>, converter::identity> &&
+      concepts::contiguous_container<lhs_t> && concepts::contiguous_container<rhs_t> &&
+      std::same_as<std::remove_cv_t<traits::range_value_t<lhs_t>>,
+                   std::remove_cv_t<traits::range_value_t<rhs_t>>> &&
+      concepts::bitwise_comparable<traits::range_value_t<lhs_t>>;
+
+    // Both sides store arithmetic element types contiguously that can be compared in chunks
+    // (see 'simd::equal').
+    template<typename lhs_t, typename rhs_t, typename converter_t>
+    concept bulk_comparable =
+      std::same_as<std::remove_cvref_t<converter_t>, converter::identity> &&
+      concepts::contiguous_container<lhs_t> && concepts::contiguous_container<rhs_t> &&
+      simd::comparable<traits::range_value_t<lhs_t>, traits::range_value_t<rhs_t>>;
+
+    // Fixed size containers compare equal to a (longer) dynamic one if the elements they share
+    // are equal, and 'lhs' is never longer than 'rhs' (it's the range that is iterated).
+    template<direction dir>
+    constexpr auto
+    comparable_sizes(auto const& lhs, auto const& rhs) -> bool
+    {
+      auto&& [to, from] = ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
+      if constexpr (!concepts::resizable_container<std::remove_cvref_t<decltype(to)>> &&
+                    concepts::resizable_container<std::remove_cvref_t<decltype(from)>>)
+      {
+        if (to.size() > from.size())
+        {
+          return false;
+        }
+      }
+      if constexpr (!concepts::resizable_container<std::remove_cvref_t<decltype(from)>> &&
+                    concepts::resizable_container<std::remove_cvref_t<decltype(to)>>)
+      {
+        if (to.size() < from.size())
+        {
+          return false;
+        }
+      }
+      if constexpr (concepts::resizable_container<std::remove_cvref_t<decltype(from)>> &&
+                    concepts::resizable_container<std::remove_cvref_t<decltype(to)>>)
+      {
+        if (to.size() != from.size())
+        {
+          return false;
+        }
+      }
+      (void)to;
+      (void)from;
+      return std::size(lhs) <= std::size(rhs);
+    }
+
+    // Element-wise sequence assignment with random access to both sides, so it can be split into
+    // independent chunks (see 'execution_policy').
+    template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
+    concept splittable_assign =
+      concepts::sequence_container<lhs_t> && concepts::sequence_container<rhs_t> &&
+      std::random_access_iterator<decltype(std::begin(std::declval<lhs_t&>()))> &&
+      std::random_access_iterator<decltype(std::begin(std::declval<rhs_t&>()))> &&
+      !assignable_with_converted<dir, lhs_t, rhs_t, converter_t>;
+
+    // Element-wise sequence comparison with random access to both sides (see 'splittable_assign').
+    template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
+    concept splittable_equal =
+      concepts::sequence_container<lhs_t> && concepts::sequence_container<rhs_t> &&
+      std::random_access_iterator<decltype(std::begin(std::declval<lhs_t&>()))> &&
+      std::random_access_iterator<decltype(std::begin(std::declval<rhs_t&>()))> &&
+      !equality_comparable_with_converted<dir, lhs_t, rhs_t, converter_t>;
+
+    // Number of elements a worker compares between checks for a mismatch found by another one.
+    constexpr std::size_t cancellation_interval = 1024;
+
+    // Key of an element of an associative container (the element itself for sets).
+    template<concepts::associative_container cont_t>
+    constexpr auto
+    key_of(typename std::remove_cvref_t<cont_t>::value_type const& elem)
+      -> typename std::remove_cvref_t<cont_t>::key_type const&
+    {
+      if constexpr (concepts::mapping_container<cont_t>)
+      {
+        return elem.first;
+      }
+      else
+      {
+        return elem;
+      }
+    }
+
+    // Mapped value of an element of an associative container (the element itself for sets).
+    template<concepts::associative_container cont_t>
+    constexpr auto
+    mapped_of(auto&& elem) -> decltype(auto)
+    {
+      if constexpr (concepts::mapping_container<cont_t>)
+      {
+        return (FWD(elem).second);
+      }
+      else
+      {
+        return FWD(elem);
+      }
+    }
+
+    // Both containers are ordered by the same (stateless) key ordering, so they can be walked in
+    // lockstep.
+    template<typename to_t, typename from_t>
+    concept same_key_order =
+      requires {
+        typename std::remove_cvref_t<to_t>::key_compare;
+        typename std::remove_cvref_t<from_t>::key_compare;
+      } &&
+      std::same_as<typename std::remove_cvref_t<to_t>::key_type,
+                   typename std::remove_cvref_t<from_t>::key_type> &&
+      std::same_as<typename std::remove_cvref_t<to_t>::key_compare,
+                   typename std::remove_cvref_t<from_t>::key_compare> &&
+      std::is_empty_v<typename std::remove_cvref_t<to_t>::key_compare>;
+
+    // Comparator (ordered) or key equality (unordered) deciding which keys are equivalent.
+    template<typename cont_t>
+    struct key_equivalence
+    {
+      using type = typename cont_t::key_equal;
+    };
+
+    template<typename cont_t>
+      requires requires { typename cont_t::key_compare; }
+    struct key_equivalence<cont_t>
+    {
+      using type = typename cont_t::key_compare;
+    };
+
+    template<typename cont_t>
+    using key_equivalence_t = typename key_equivalence<std::remove_cvref_t<cont_t>>::type;
+
+    template<typename cont_t, typename key_t = typename std::remove_cvref_t<cont_t>::key_type>
+    concept standard_key_equivalence =
+      std::same_as<key_equivalence_t<cont_t>, std::less<key_t>> ||
+      std::same_as<key_equivalence_t<cont_t>, std::less<>> ||
+      std::same_as<key_equivalence_t<cont_t>, std::greater<key_t>> ||
+      std::same_as<key_equivalence_t<cont_t>, std::greater<>> ||
+      std::same_as<key_equivalence_t<cont_t>, std::equal_to<key_t>> ||
+      std::same_as<key_equivalence_t<cont_t>, std::equal_to<>>;
+
+    // Keys of 'to' can be looked up in 'from' as-is: both hold the same key type & agree on which
+    // keys are equivalent. Otherwise (eg. lossy key conversions such as 'double' to 'int') a key
+    // of 'to' missing in 'from' may still be the image of a key of 'from'.
+    template<typename to_t, typename from_t>
+    concept same_key_equivalence =
+      std::same_as<typename std::remove_cvref_t<to_t>::key_type,
+                   typename std::remove_cvref_t<from_t>::key_type> &&
+      (std::same_as<key_equivalence_t<to_t>, key_equivalence_t<from_t>> ||
+       (standard_key_equivalence<to_t> && standard_key_equivalence<from_t>));
+
+    // Keys of 'from' can be ordered by the key order of 'to' (eg. to sort an unordered 'from').
+    template<typename to_t, typename from_t>
+    concept sortable_keys_of =
+      requires { typename std::remove_cvref_t<to_t>::key_compare; } &&
+      std::same_as<typename std::remove_cvref_t<to_t>::key_type,
+                   typename std::remove_cvref_t<from_t>::key_type>;
+
+    // 'from' is a non-const rvalue with unique keys whose nodes are compatible with those of 'to'
+    // (eg. same key & value but different comparator/hash), so they can be handed over as-is.
+    template<typename to_t, typename from_t, typename converter_t>
+    concept node_transferable =
+      std::same_as<std::remove_cvref_t<converter_t>, converter::identity> &&
+      !std::is_lvalue_reference_v<from_t> && !std::is_const_v<std::remove_reference_t<from_t>> &&
+      requires { typename std::remove_cvref_t<from_t>::insert_return_type; } &&
+      std::same_as<typename std::remove_cvref_t<to_t>::node_type,
+                   typename std::remove_cvref_t<from_t>::node_type> &&
+      requires (std::remove_reference_t<to_t>& to, std::remove_reference_t<from_t>& from) {
+        to.merge(from);
+      };
+
+    // Nodes of 'to' can be extracted & re-inserted with the key of an element of 'from'.
+    template<typename to_t, typename from_t>
+    concept recyclable_nodes =
+      requires (std::remove_cvref_t<to_t>& to) { to.extract(std::begin(to)); } &&
+      (!concepts::mapping_container<to_t> ||
+       requires (std::remove_cvref_t<to_t>& to, traits::range_value_t<from_t> const& elem) {
+         to.extract(std::begin(to)).key() = key_of<from_t>(elem);
+       });
+
+    // Visits the elements of 'to' whose keys are missing in 'from' (in the order of 'to'), so
+    // their nodes can be recycled for keys missing in 'to' instead of being freed & reallocated.
+    // Keys are checked by walking 'from' alongside when both share the same key order, otherwise
+    // by looking them up in 'from'. Inserting keys of 'from' into 'to' doesn't affect the walk.
+    template<concepts::associative_container to_t, concepts::associative_container from_t>
+    struct stale_nodes
+    {
+      using iterator_t = decltype(std::begin(std::declval<to_t&>()));
+
+      stale_nodes(to_t& to, from_t const& from)
+        : to_(to)
+        , from_(from)
+        , itr_(std::begin(to))
+        , fromItr_(std::begin(from))
+      {}
+
+      // Moves on to the next stale element (if any).
+      [[nodiscard]] auto
+      next() -> bool
+      {
+        for (; itr_ != std::end(to_); ++itr_)
+        {
+          if (!from_contains(key_of<to_t>(*itr_)))
+          {
+            return true;
+          }
+        }
+        return false;
+      }
+
+      // Extracts the current stale element & moves 'other' past it if it points to it.
+      auto
+      extract(iterator_t& other)
+      {
+        if (other == itr_)
+        {
+          ++other;
+        }
+        return to_.extract(itr_++);
+      }
+
+      auto
+      extract()
+      {
+        return to_.extract(itr_++);
+      }
+
+      // Erases the remaining stale elements (once 'to' holds all keys of 'from').
+      void
+      erase_remaining()
+      {
+        while (next())
+        {
+          itr_ = to_.erase(itr_);
+        }
+      }
+
+    private:
+      auto
+      from_contains(auto const& key) -> bool
+      {
+        if constexpr (same_key_order<to_t, from_t>)
+        {
+          auto const comp = to_.key_comp();
+          while (fromItr_ != std::end(from_) && comp(key_of<from_t>(*fromItr_), key))
+          {
+            ++fromItr_;
+          }
+          return fromItr_ != std::end(from_) && !comp(key, key_of<from_t>(*fromItr_));
+        }
+        else
+        {
+          return from_.contains(key);
+        }
+      }
+
+      to_t&                                             to_;   // NOLINT
+      from_t const&                                     from_; // NOLINT
+      iterator_t                                        itr_;
+      decltype(std::begin(std::declval<from_t const&>())) fromItr_;
+    };
   }
 
   struct assign
   {
     template<direction dir        = direction::rhs_to_lhs, typename lhs_t, typename rhs_t,
              typename converter_t = converter::identity>
-    constexpr auto operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t converter = {}) const
+    constexpr auto operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter = {}) const
       -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
       requires details::assignable_with_converted<dir, lhs_t&&, rhs_t&&, converter_t>;
 
     template<direction dir = direction::rhs_to_lhs, concepts::sequence_container lhs_t,
              concepts::sequence_container rhs_t, typename converter_t = converter::identity>
-    constexpr auto operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t converter = {}) const
+    constexpr auto operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter = {}) const
       -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
       requires (!details::assignable_with_converted<dir, lhs_t &&, rhs_t &&, converter_t>) &&
                details::invocable_with<assign, dir, traits::range_value_forwarded_t<lhs_t>,
@@ -175,16 +382,30 @@ namespace convertible::operators
 
     template<direction dir = direction::rhs_to_lhs, concepts::associative_container lhs_t,
              concepts::associative_container rhs_t, typename converter_t = converter::identity>
-    constexpr auto operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t converter = {}) const
+    constexpr auto operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter = {}) const
       -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
       requires (!details::assignable_with_converted<dir, lhs_t &&, rhs_t &&, converter_t>) &&
                details::invocable_with<assign, dir, traits::mapped_value_forwarded_t<lhs_t>,
                                        traits::mapped_value_forwarded_t<rhs_t>, converter_t>;
+
+    // Element-wise sequence assignments are split into chunks run according to 'policy',
+    // anything else is assigned as without a policy.
+    template<direction dir = direction::rhs_to_lhs, concepts::execution_policy policy_t,
+             typename lhs_t, typename rhs_t, typename converter_t = converter::identity>
+    constexpr auto operator()(policy_t const& policy, lhs_t&& lhs, rhs_t&& rhs,
+                              converter_t&& converter = {}) const
+      -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
+      requires details::invocable_with<assign, dir, lhs_t&&, rhs_t&&, converter_t>;
+
+  private:
+    template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
+    constexpr void assign_elements(lhs_t&& lhs, rhs_t&& rhs, std::size_t first, std::size_t last,
+                                   converter_t& converter) const;
   };
 
   template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
   constexpr auto
-  assign::operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t converter) const
+  assign::operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter) const
     -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
     requires details::assignable_with_converted<dir, lhs_t&&, rhs_t&&, converter_t>
   {
@@ -206,7 +427,7 @@ namespace convertible::operators
   template<direction dir, concepts::sequence_container lhs_t, concepts::sequence_container rhs_t,
            typename converter_t>
   constexpr auto
-  assign::operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t converter) const
+  assign::operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter) const
     -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
     requires (!details::assignable_with_converted<dir, lhs_t &&, rhs_t &&, converter_t>) &&
              details::invocable_with<assign, dir, traits::range_value_forwarded_t<lhs_t>,
@@ -214,56 +435,296 @@ namespace convertible::operators
   {
     // 1. figure out 'from' & 'to'
     // 2. if 'to' is resizeable: to.resize(from.size())
-    // 3. iterate values
-    // 4. call assign with lhs & rhs respective range values
+    // 3. if elements are contiguous & trivially copyable or arithmetic: copy/convert in bulk
+    // 4. else iterate values
+    // 5. call assign with lhs & rhs respective range values
 
     auto&& [to, from] = details::ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
 
     if constexpr (concepts::resizable_container<decltype(to)>)
     {
-      to.resize(from.size());
+      to.resize(std::size(from));
     }
 
-    auto const size = std::min(lhs.size(), rhs.size());
-    auto       end  = std::begin(rhs);
-    std::advance(end, size);
-    std::for_each(std::begin(rhs), end,
-                  [this, lhsItr = std::begin(lhs), &converter](auto&& rhsElem) mutable
+    auto const size = std::min(std::size(lhs), std::size(rhs));
+    assign_elements<dir>(FWD(lhs), FWD(rhs), 0, size, converter);
+
+    return FWD(to);
+  }
+
+  template<direction dir, concepts::execution_policy policy_t, typename lhs_t, typename rhs_t,
+           typename converter_t>
+  constexpr auto
+  assign::operator()(policy_t const& policy, lhs_t&& lhs, rhs_t&& rhs,
+                     converter_t&& converter) const -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
+    requires details::invocable_with<assign, dir, lhs_t&&, rhs_t&&, converter_t>
+  {
+    if constexpr (details::splittable_assign<dir, lhs_t&&, rhs_t&&, converter_t>)
+    {
+      auto&& [to, from] = details::ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
+
+      if constexpr (concepts::resizable_container<decltype(to)>)
+      {
+        to.resize(std::size(from));
+      }
+
+      policy.bulk(std::min(std::size(lhs), std::size(rhs)),
+                  [this, &lhs, &rhs, &converter](std::size_t first, std::size_t last)
                   {
-                    this->template operator()<dir>(
-                      std::forward<traits::range_value_forwarded_t<decltype(lhs)>>(*lhsItr++),
-                      std::forward<traits::range_value_forwarded_t<decltype(rhs)>>(FWD(rhsElem)),
-                      converter);
+                    assign_elements<dir>(FWD(lhs), FWD(rhs), first, last, converter);
                   });
+      return FWD(to);
+    }
+    else
+    {
+      (void)policy;
+      return this->template operator()<dir>(FWD(lhs), FWD(rhs), FWD(converter));
+    }
+  }
 
-    return FWD(to);
+  template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
+  constexpr void
+  assign::assign_elements(lhs_t&& lhs, rhs_t&& rhs, std::size_t first, std::size_t last,
+                          converter_t& converter) const
+  {
+    auto&& [to, from] = details::ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
+    (void)to;
+    (void)from;
+
+    auto const size = last - first;
+
+    // neither memcpy nor intrinsics are usable in constant expressions, so those fall through to
+    // the element-wise assignment.
+    if constexpr (details::bulk_copyable<lhs_t, rhs_t, converter_t>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        using value_t = traits::range_value_t<lhs_t>;
+        if (size > 0)
+        {
+          std::memcpy(std::data(to) + first, std::data(from) + first, size * sizeof(value_t));
+        }
+        return;
+      }
+    }
+    else if constexpr (details::bulk_convertible<traits::lhs_t<dir, lhs_t, rhs_t>,
+                                                 traits::rhs_t<dir, lhs_t, rhs_t>, converter_t>)
+    {
+      if (!std::is_constant_evaluated())
+      {
+        simd::convert(std::data(from) + first, std::data(to) + first, size);
+        return;
+      }
+    }
+
+    auto lhsItr = std::begin(lhs);
+    auto rhsItr = std::begin(rhs);
+    std::advance(lhsItr, first);
+    std::advance(rhsItr, first);
+    for (auto i = first; i < last; ++i, ++lhsItr, ++rhsItr)
+    {
+      this->template operator()<dir>(
+        std::forward<traits::range_value_forwarded_t<decltype(lhs)>>(*lhsItr),
+        std::forward<traits::range_value_forwarded_t<decltype(rhs)>>(*rhsItr), converter);
+    }
   }
 
   template<direction dir, concepts::associative_container lhs_t,
            concepts::associative_container rhs_t, typename converter_t>
   constexpr auto
-  assign::operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t converter) const
+  assign::operator()(lhs_t&& lhs, rhs_t&& rhs, converter_t&& converter) const
     -> traits::lhs_t<dir, lhs_t&&, rhs_t&&>
     requires (!details::assignable_with_converted<dir, lhs_t &&, rhs_t &&, converter_t>) &&
              details::invocable_with<assign, dir, traits::mapped_value_forwarded_t<lhs_t>,
                                      traits::mapped_value_forwarded_t<rhs_t>, converter_t>
   {
     // 1. figure out 'from', and use that as 'key range'
-    // 2. clear 'to'
-    // 3. iterate keys
-    // 4. create associative_inserter for lhs & rhs using the key
-    // 5. call assign with lhs & rhs mapped value respectively (indirectly using inserter)
+    // 2. if 'from' is an rvalue with compatible nodes: clear 'to' & hand them over
+    // 3. otherwise iterate elements of 'from'
+    // 4. find the mapped value of 'to' with the same key (inserting it if missing):
+    //    - same key order: walk 'to' alongside 'from' & insert with the position as hint
+    //    - ordered & empty 'to': same as above, but with 'from' sorted up front
+    //    - otherwise: look it up (with room reserved up front for unordered containers)
+    //    - missing keys reuse the nodes of keys missing in 'from' (if any), rather than
+    //      freeing them & allocating new ones
+    // 5. call assign with lhs & rhs mapped value respectively (overwriting it in place)
+    // 6. erase (remaining) keys of 'to' missing in 'from'
 
     auto&& [to, from] = details::ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
-    to.clear();
-    for (decltype(auto) key : FWD(from))
+    using to_t        = std::remove_cvref_t<decltype(to)>;
+    using from_t      = std::remove_cvref_t<decltype(from)>;
+
+    if constexpr (details::node_transferable<traits::lhs_t<dir, lhs_t&&, rhs_t&&>,
+                                             traits::rhs_t<dir, lhs_t&&, rhs_t&&>, converter_t>)
+    {
+      to.clear();
+      to.merge(from);
+    }
+    else
     {
-      details::associative_inserter(FWD(to), FWD(key)) = this->template operator()<dir>(
-        std::forward<traits::mapped_value_forwarded_t<decltype(lhs)>>(
-          details::associative_inserter(FWD(lhs), key)),
-        std::forward<traits::mapped_value_forwarded_t<decltype(rhs)>>(
-          details::associative_inserter(FWD(rhs), key)),
-        converter);
+      // NOTE: set elements are keys, which a converter other than identity may change
+      constexpr bool keys_comparable =
+        (concepts::mapping_container<to_t> ||
+         std::same_as<std::remove_cvref_t<converter_t>, converter::identity>) &&
+        details::same_key_equivalence<to_t, from_t>;
+      constexpr bool recyclable = keys_comparable && details::recyclable_nodes<to_t, from_t>;
+      if constexpr (!keys_comparable)
+      {
+        // keys can't be looked up in 'from' before they are converted
+        to.clear();
+      }
+
+      auto const assignMapped = [this, &converter](auto&& toMapped, auto&& fromMapped)
+      {
+        std::apply(
+          [this, &converter](auto&& lhsMapped, auto&& rhsMapped)
+          {
+            this->template operator()<dir>(FWD(lhsMapped), FWD(rhsMapped), converter);
+          },
+          details::ordered_lhs_rhs<dir>(FWD(toMapped), FWD(fromMapped)));
+      };
+
+      // walks 'to' alongside (pointers to) elements of 'from' sorted by the key order of 'to'
+      auto const mergeAssign = [&assignMapped, &from](auto& target, auto&& elems, auto const& deref)
+      {
+        auto const comp  = target.key_comp();
+        auto       stale = details::stale_nodes(target, from);
+        auto       itr   = std::begin(target);
+        for (auto&& ref : elems)
+        {
+          auto&&      elem = deref(ref);
+          auto const& key  = details::key_of<from_t>(elem);
+          while (itr != std::end(target) && comp(itr->first, key))
+          {
+            ++itr; // stale, recycled or erased below
+          }
+          // NOTE: 'itr' is already the successor of an inserted element (walking there from the
+          //       new element could climb the whole tree)
+          auto pos = itr;
+          if (itr != std::end(target) && !comp(key, itr->first))
+          {
+            ++itr;
+          }
+          else
+          {
+            if constexpr (recyclable)
+            {
+              if (stale.next())
+              {
+                auto node  = stale.extract(itr);
+                node.key() = key;
+                pos        = target.insert(itr, std::move(node));
+              }
+            }
+            if (pos == itr)
+            {
+              pos = target.try_emplace(itr, key);
+            }
+          }
+          assignMapped(std::forward_like<decltype(to)>(pos->second),
+                       std::forward_like<decltype(from)>(elem.second));
+        }
+        stale.erase_remaining();
+      };
+
+      if constexpr (concepts::mapping_container<to_t> && details::same_key_order<to_t, from_t>)
+      {
+        mergeAssign(to, from,
+                    [](auto& elem) -> auto&
+                    {
+                      return elem;
+                    });
+        return FWD(to);
+      }
+      else if constexpr (concepts::mapping_container<to_t> &&
+                         details::sortable_keys_of<to_t, from_t>)
+      {
+        // bulk build: sort 'from' once rather than searching 'to' for each key
+        if (std::empty(to))
+        {
+          auto elems = std::vector<decltype(&*std::begin(from))>{};
+          elems.reserve(std::size(from));
+          for (auto& elem : from)
+          {
+            elems.push_back(&elem);
+          }
+          std::sort(std::begin(elems), std::end(elems),
+                    [comp = to.key_comp()](auto const* lhsElem, auto const* rhsElem)
+                    {
+                      return comp(lhsElem->first, rhsElem->first);
+                    });
+          mergeAssign(to, elems,
+                      [](auto* elem) -> auto&
+                      {
+                        return *elem;
+                      });
+          return FWD(to);
+        }
+      }
+
+      if constexpr (requires { to.reserve(std::size(from)); })
+      {
+        // NOTE: also keeps iterators valid while recycling nodes (no rehash)
+        to.reserve(std::max(std::size(to), std::size(from)));
+      }
+
+      auto stale = details::stale_nodes(to, from);
+      for (auto&& elem : from)
+      {
+        if constexpr (concepts::mapping_container<to_t>)
+        {
+          auto const& key   = details::key_of<from_t>(elem);
+          auto        found = to.find(key);
+          if (found == std::end(to))
+          {
+            if constexpr (recyclable)
+            {
+              if (stale.next())
+              {
+                auto node  = stale.extract();
+                node.key() = key;
+                found      = to.insert(std::end(to), std::move(node));
+              }
+            }
+            if (found == std::end(to))
+            {
+              found = to.try_emplace(key).first;
+            }
+          }
+          assignMapped(std::forward_like<decltype(to)>(found->second),
+                       std::forward_like<decltype(from)>(elem.second));
+        }
+        else
+        {
+          if constexpr (keys_comparable)
+          {
+            if (to.contains(elem))
+            {
+              continue;
+            }
+          }
+          if constexpr (recyclable)
+          {
+            if (stale.next())
+            {
+              auto node = stale.extract();
+              assignMapped(std::forward_like<decltype(to)>(node.value()),
+                           std::forward_like<decltype(from)>(elem));
+              to.insert(std::move(node));
+              continue;
+            }
+          }
+          auto value = typename to_t::value_type{};
+          assignMapped(std::forward_like<decltype(to)>(value),
+                       std::forward_like<decltype(from)>(elem));
+          to.insert(std::move(value));
+        }
+      }
+
+      if constexpr (keys_comparable)
+      {
+        stale.erase_remaining();
+      }
     }
 
     return FWD(to);
@@ -273,14 +734,14 @@ namespace convertible::operators
   {
     template<direction dir        = direction::rhs_to_lhs, typename lhs_t, typename rhs_t,
              typename converter_t = converter::identity>
-    constexpr auto operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t converter = {}) const
-      -> bool
+    constexpr auto operator()(lhs_t const& lhs, rhs_t const& rhs,
+                              converter_t&& converter = {}) const -> bool
       requires details::equality_comparable_with_converted<dir, lhs_t&&, rhs_t&&, converter_t>;
 
     template<direction dir = direction::rhs_to_lhs, concepts::sequence_container lhs_t,
              concepts::sequence_container rhs_t, typename converter_t = converter::identity>
-    constexpr auto operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t converter = {}) const
-      -> bool
+    constexpr auto operator()(lhs_t const& lhs, rhs_t const& rhs,
+                              converter_t&& converter = {}) const -> bool
       requires (!details::equality_comparable_with_converted<dir, lhs_t &&, rhs_t &&,
                                                              converter_t>) &&
                details::invocable_with<equal, dir, traits::range_value_forwarded_t<lhs_t>,
@@ -288,20 +749,34 @@ namespace convertible::operators
 
     template<direction dir = direction::rhs_to_lhs, concepts::associative_container lhs_t,
              concepts::associative_container rhs_t, typename converter_t = converter::identity>
-    constexpr auto operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t converter = {}) const
-      -> bool
+    constexpr auto operator()(lhs_t const& lhs, rhs_t const& rhs,
+                              converter_t&& converter = {}) const -> bool
       requires (!details::equality_comparable_with_converted<dir, lhs_t &&, rhs_t &&,
                                                              converter_t>) &&
                details::invocable_with<equal, dir, traits::mapped_value_forwarded_t<lhs_t>,
                                        traits::mapped_value_forwarded_t<rhs_t>, converter_t>;
+
+    // Element-wise sequence comparisons are split into chunks run according to 'policy', where
+    // the first mismatch stops all chunks. Anything else is compared as without a policy.
+    template<direction dir = direction::rhs_to_lhs, concepts::execution_policy policy_t,
+             typename lhs_t, typename rhs_t, typename converter_t = converter::identity>
+    auto operator()(policy_t const& policy, lhs_t const& lhs, rhs_t const& rhs,
+                    converter_t&& converter = {}) const -> bool
+      requires details::invocable_with<equal, dir, lhs_t const&, rhs_t const&, converter_t>;
+
+  private:
+    template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
+    constexpr auto equal_elements(lhs_t const& lhs, rhs_t const& rhs, std::size_t first,
+                                  std::size_t last, converter_t& converter) const -> bool;
   };
 
   template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
   constexpr auto
-  equal::operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t converter) const -> bool
+  equal::operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t&& converter) const -> bool
     requires details::equality_comparable_with_converted<dir, lhs_t&&, rhs_t&&, converter_t>
   {
-    if constexpr (concepts::mapping<converter_t>)
+    constexpr auto ok = requires { converter.template equal<dir>(FWD(lhs), FWD(rhs)); };
+    if constexpr (ok)
     {
       return converter.template equal<dir>(FWD(lhs), FWD(rhs));
     }
@@ -316,40 +791,92 @@ namespace convertible::operators
   template<direction dir, concepts::sequence_container lhs_t, concepts::sequence_container rhs_t,
            typename converter_t>
   constexpr auto
-  equal::operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t converter) const -> bool
+  equal::operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t&& converter) const -> bool
     requires (!details::equality_comparable_with_converted<dir, lhs_t &&, rhs_t &&, converter_t>) &&
              details::invocable_with<equal, dir, traits::range_value_forwarded_t<lhs_t>,
                                      traits::range_value_forwarded_t<rhs_t>, converter_t>
   {
-    auto&& [to, from] = details::ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
-    if constexpr (!concepts::resizable_container<std::remove_cvref_t<decltype(to)>> &&
-                  concepts::resizable_container<std::remove_cvref_t<decltype(from)>>)
+    if (!details::comparable_sizes<dir>(lhs, rhs))
     {
-      if (to.size() > from.size())
+      return false;
+    }
+    return equal_elements<dir>(lhs, rhs, 0, std::size(lhs), converter);
+  }
+
+  template<direction dir, concepts::execution_policy policy_t, typename lhs_t, typename rhs_t,
+           typename converter_t>
+  auto
+  equal::operator()(policy_t const& policy, lhs_t const& lhs, rhs_t const& rhs,
+                    converter_t&& converter) const -> bool
+    requires details::invocable_with<equal, dir, lhs_t const&, rhs_t const&, converter_t>
+  {
+    if constexpr (details::splittable_equal<dir, lhs_t const&, rhs_t const&, converter_t>)
+    {
+      if (!details::comparable_sizes<dir>(lhs, rhs))
       {
         return false;
       }
+
+      auto mismatch = std::atomic<bool>{false};
+      policy.bulk(std::size(lhs),
+                  [this, &lhs, &rhs, &converter, &mismatch](std::size_t first, std::size_t last)
+                  {
+                    for (auto begin = first; begin < last; begin += details::cancellation_interval)
+                    {
+                      if (mismatch.load(std::memory_order_relaxed))
+                      {
+                        return;
+                      }
+                      auto const end = std::min(begin + details::cancellation_interval, last);
+                      if (!equal_elements<dir>(lhs, rhs, begin, end, converter))
+                      {
+                        mismatch.store(true, std::memory_order_relaxed);
+                        return;
+                      }
+                    }
+                  });
+      return !mismatch.load();
     }
-    if constexpr (!concepts::resizable_container<std::remove_cvref_t<decltype(from)>> &&
-                  concepts::resizable_container<std::remove_cvref_t<decltype(to)>>)
+    else
     {
-      if (to.size() < from.size())
+      (void)policy;
+      return this->template operator()<dir>(lhs, rhs, FWD(converter));
+    }
+  }
+
+  template<direction dir, typename lhs_t, typename rhs_t, typename converter_t>
+  constexpr auto
+  equal::equal_elements(lhs_t const& lhs, rhs_t const& rhs, std::size_t first, std::size_t last,
+                        converter_t& converter) const -> bool
+  {
+    auto const size = last - first;
+
+    // neither memcmp nor intrinsics are usable in constant expressions, so those fall through to
+    // the element-wise comparison.
+    if constexpr (details::bulk_bitwise_comparable<lhs_t, rhs_t, converter_t>)
+    {
+      if (!std::is_constant_evaluated())
       {
-        return false;
+        return size == 0 ||
+               std::memcmp(std::data(lhs) + first, std::data(rhs) + first,
+                           size * sizeof(traits::range_value_t<lhs_t>)) == 0;
       }
     }
-    if constexpr (concepts::resizable_container<std::remove_cvref_t<decltype(from)>> &&
-                  concepts::resizable_container<std::remove_cvref_t<decltype(to)>>)
+    else if constexpr (details::bulk_comparable<lhs_t, rhs_t, converter_t>)
     {
-      if (to.size() != from.size())
+      if (!std::is_constant_evaluated())
       {
-        return false;
+        return simd::equal(std::data(lhs) + first, std::data(rhs) + first, size);
       }
     }
-    (void)to;
-    (void)from;
 
-    return std::equal(std::cbegin(lhs), std::cend(lhs), std::cbegin(rhs),
+    auto lhsItr = std::cbegin(lhs);
+    auto rhsItr = std::cbegin(rhs);
+    std::advance(lhsItr, first);
+    std::advance(rhsItr, first);
+    auto lhsEnd = lhsItr;
+    std::advance(lhsEnd, size);
+    return std::equal(lhsItr, lhsEnd, rhsItr,
                       [this, &converter](auto&& lhs, auto&& rhs)
                       {
                         return this->template operator()<dir>(FWD(lhs), FWD(rhs), converter);
@@ -359,36 +886,61 @@ namespace convertible::operators
   template<direction dir, concepts::associative_container lhs_t,
            concepts::associative_container rhs_t, typename converter_t>
   constexpr auto
-  equal::operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t converter) const -> bool
+  equal::operator()(lhs_t const& lhs, rhs_t const& rhs, converter_t&& converter) const -> bool
     requires (!details::equality_comparable_with_converted<dir, lhs_t &&, rhs_t &&, converter_t>) &&
              details::invocable_with<equal, dir, traits::mapped_value_forwarded_t<lhs_t>,
                                      traits::mapped_value_forwarded_t<rhs_t>, converter_t>
   {
-    // 1. use actual lhs as 'key range'
-    // 2. iterate keys
-    // 3. check that actual rhs contains key
-    // 4. create associative_inserter for lhs & rhs using the key
-    // 5. call equal with lhs & rhs mapped value respectively (indirectly using inserter)
+    // 1. fail fast if the number of keys differ
+    // 2. use actual lhs as 'key range'
+    // 3. same key order: walk actual lhs & rhs in lockstep
+    // 4. otherwise: find each key of actual lhs in actual rhs
+    // 5. call equal with lhs & rhs mapped value respectively
+
+    if (std::size(lhs) != std::size(rhs))
+    {
+      return false;
+    }
 
     auto const& [actualLhs, actualRhs] = details::ordered_lhs_rhs<dir>(FWD(lhs), FWD(rhs));
-    for (auto const& elem : actualLhs)
+    using actual_lhs_t                 = std::remove_cvref_t<decltype(actualLhs)>;
+    using actual_rhs_t                 = std::remove_cvref_t<decltype(actualRhs)>;
+
+    auto const equalMapped = [this, &converter](auto const& lhsElem, auto const& rhsElem)
     {
-      if (!details::associative_inserter(FWD(actualRhs), elem).has_value())
-      {
-        return false;
-      }
+      return std::apply(
+        [this, &converter](auto const& lhsMapped, auto const& rhsMapped)
+        {
+          return this->template operator()<dir>(lhsMapped, rhsMapped, converter);
+        },
+        details::ordered_lhs_rhs<dir>(details::mapped_of<actual_lhs_t>(lhsElem),
+                                      details::mapped_of<actual_rhs_t>(rhsElem)));
+    };
 
-      if (!this->template operator()<dir>(
-            std::forward<traits::mapped_value_forwarded_t<decltype(lhs)>>(
-              details::associative_inserter(FWD(lhs), elem)),
-            std::forward<traits::mapped_value_forwarded_t<decltype(rhs)>>(
-              details::associative_inserter(FWD(rhs), elem)),
-            converter))
+    if constexpr (details::same_key_order<actual_lhs_t, actual_rhs_t>)
+    {
+      auto const comp = actualLhs.key_comp();
+      return std::equal(std::begin(actualLhs), std::end(actualLhs), std::begin(actualRhs),
+                        [&comp, &equalMapped](auto const& lhsElem, auto const& rhsElem)
+                        {
+                          auto const& lhsKey = details::key_of<actual_lhs_t>(lhsElem);
+                          auto const& rhsKey = details::key_of<actual_rhs_t>(rhsElem);
+                          return !comp(lhsKey, rhsKey) && !comp(rhsKey, lhsKey) &&
+                                 equalMapped(lhsElem, rhsElem);
+                        });
+    }
+    else
+    {
+      for (auto const& elem : actualLhs)
       {
-        return false;
+        auto const found = actualRhs.find(details::key_of<actual_lhs_t>(elem));
+        if (found == std::end(actualRhs) || !equalMapped(elem, *found))
+        {
+          return false;
+        }
       }
+      return true;
     }
-    return true;
   }
 }
 
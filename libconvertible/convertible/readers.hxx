@@ -59,6 +59,22 @@ namespace convertible::reader
     member_ptr_t ptr_;
   };
 
+  // Same as 'member', with the member pointer encoded in the type (ie. an empty reader).
+  template<auto ptr>
+    requires concepts::member_ptr<decltype(ptr)>
+  struct member_constant
+  {
+    using class_t = traits::member_class_t<decltype(ptr)>;
+
+    template<typename obj_t>
+      requires std::derived_from<std::remove_reference_t<obj_t>, class_t>
+    constexpr auto
+    operator()(obj_t&& obj) const -> decltype(auto)
+    {
+      return member<decltype(ptr)>(ptr)(std::forward<obj_t>(obj));
+    }
+  };
+
   template<details::const_value i>
   struct index
   {
@@ -87,8 +103,12 @@ namespace convertible::reader
     }
   };
 
+  // Reads optional-like objects, enabled only when holding a value.
   struct maybe
   {
+    // Write path: a modifiable empty 'obj' is given a (default constructed) value, so it can be
+    // assigned through. Reads go through 'adapter::read_if', which checks 'enabled' first, so an
+    // empty 'obj' is only given a value when one is actually being assigned.
     constexpr auto
     operator()(concepts::dereferencable auto&& obj) const -> decltype(auto)
       requires std::constructible_from<bool, decltype(obj)>
@@ -153,34 +173,43 @@ namespace convertible::reader
       }
     }
 
+    // Same as 'compose', but with a per-call context passed on to each adapter.
     static constexpr auto
-    enabled_impl(auto&& arg, concepts::adapter auto&& head, concepts::adapter auto&&... tail)
-      -> bool
-      requires (is_composable<decltype(arg), decltype(head), decltype(tail)...>())
+    compose_with(auto& context, auto&& arg, concepts::adapter auto&& head,
+                 concepts::adapter auto&&... tail) -> decltype(auto)
     {
       if constexpr (sizeof...(tail) == 0)
       {
-        constexpr auto ok = requires { FWD(head).enabled(FWD(arg)); };
-        if constexpr (ok)
-        {
-          return FWD(head).enabled(FWD(arg));
-        }
-        else
-        {
-          return true;
-        }
+        return FWD(head)(FWD(arg), context);
+      }
+      else
+      {
+        return compose_with(context, FWD(head)(FWD(arg), context), FWD(tail)...);
       }
-      else if (enabled_impl(FWD(arg), FWD(head)))
+    }
+
+    // Checks & reads each step of the chain once, passing the result of the last one to 'fn'.
+    static constexpr auto
+    read_if_impl(auto&& arg, auto& fn, concepts::adapter auto const& head,
+                 concepts::adapter auto const&... tail) -> bool
+    {
+      if constexpr (sizeof...(tail) == 0)
       {
-        return enabled_impl(compose(FWD(arg), FWD(head)), FWD(tail)...);
+        return head.read_if(FWD(arg), fn);
       }
       else
       {
-        return false;
+        auto read = false;
+        head.read_if(FWD(arg),
+                     [&read, &fn, &tail...](auto&& next)
+                     {
+                       read = read_if_impl(FWD(next), fn, tail...);
+                     });
+        return read;
       }
     }
 
-    adapters_t adapters_;
+    CONVERTIBLE_NO_UNIQUE_ADDRESS adapters_t adapters_;
 
   public:
     constexpr composed(adapter_ts... adapters)
@@ -200,18 +229,38 @@ namespace convertible::reader
         adapters_);
     }
 
+    template<typename arg_t>
     constexpr auto
-    enabled(auto&& arg) const -> bool
-      requires requires { enabled_impl(FWD(arg), std::declval<adapter_ts>()...); }
+    operator()(arg_t&& arg, auto& context) const -> decltype(auto)
+      requires requires () { compose(FWD(arg), std::declval<adapter_ts>()...); }
     {
-      using arg_t = decltype(arg);
       return std::apply(
-        [&arg](auto&&... adapters) -> bool
+        [&arg, &context](auto&&... adapters) -> decltype(auto)
         {
-          return enabled_impl(std::forward<arg_t>(arg), FWD(adapters)...);
+          return compose_with(context, std::forward<arg_t>(arg), FWD(adapters)...);
         },
         adapters_);
     }
+
+    template<typename arg_t>
+    constexpr auto
+    read_if(arg_t&& arg, auto&& fn) const -> bool
+      requires requires () { compose(FWD(arg), std::declval<adapter_ts>()...); }
+    {
+      return std::apply(
+        [&arg, &fn](auto const&... adapters) -> bool
+        {
+          return read_if_impl(std::forward<arg_t>(arg), fn, adapters...);
+        },
+        adapters_);
+    }
+
+    constexpr auto
+    enabled(auto&& arg) const -> bool
+      requires requires (composed const& self) { self(FWD(arg)); }
+    {
+      return read_if(FWD(arg), [](auto&&) {});
+    }
   };
 }
 
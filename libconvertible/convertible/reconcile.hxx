@@ -0,0 +1,259 @@
+#pragma once
+
+#include <convertible/common.hxx>
+#include <convertible/concepts.hxx>
+#include <convertible/mapping.hxx>
+#include <convertible/mapping_table.hxx>
+#include <convertible/operators.hxx>
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace convertible
+{
+  namespace concepts
+  {
+    // Collections 'reconciler' can update in place: random access, appendable & erasable.
+    template<typename cont_t>
+    concept reconcilable_container =
+      range<cont_t> &&
+      requires (std::remove_cvref_t<cont_t>& cont) {
+        cont[std::size_t{}];
+        cont.emplace_back();
+        cont.erase(std::begin(cont), std::end(cont));
+        { std::size(cont) } -> std::convertible_to<std::size_t>;
+      };
+  }
+
+  // Changes bringing a target collection in line with a source collection, by index.
+  struct reconcile_plan
+  {
+    // source records whose key is missing in the target
+    std::vector<std::size_t> inserts;
+    // target & source records sharing a key but differing otherwise
+    std::vector<std::pair<std::size_t, std::size_t>> updates;
+    // target records whose key is missing in the source (ascending)
+    std::vector<std::size_t> erases;
+
+    constexpr auto
+    empty() const -> bool
+    {
+      return inserts.empty() && updates.empty() && erases.empty();
+    }
+  };
+
+  // Synchronizes collections of records keyed by the member(s) mapped by 'key' ('equal' &
+  // 'hash_lhs'/'hash_rhs'), using 'table' to compare & assign the records themselves. Source
+  // records are matched to target records through a hash index, so it takes O(n) on average.
+  // Each target record is matched at most once, ie. duplicate keys are paired up in order.
+  template<concepts::mapping table_t, concepts::mapping key_t>
+  struct reconciler
+  {
+    constexpr explicit reconciler(table_t table, key_t key)
+      : table_(std::move(table))
+      , key_(std::move(key))
+    {}
+
+    // Inserts, updates & erases that make the 'dir' target equal to its source.
+    template<direction dir = direction::rhs_to_lhs>
+    auto
+    plan(concepts::range auto const& lhs, concepts::range auto const& rhs) const
+      -> reconcile_plan
+      requires requires (table_t const& table, key_t const& key,
+                         traits::range_value_t<decltype(lhs)> const& lhsElem,
+                         traits::range_value_t<decltype(rhs)> const& rhsElem) {
+                 key.hash_lhs(lhsElem);
+                 key.hash_rhs(rhsElem);
+                 key.equal(lhsElem, rhsElem);
+                 table.template equal<dir>(lhsElem, rhsElem);
+               }
+    {
+      auto const& [to, from] = operators::details::ordered_lhs_rhs<dir>(lhs, rhs);
+
+      // target records by key hash, in their order
+      auto index = std::unordered_map<std::size_t, index_entry>{};
+      index.reserve(std::size(to));
+      for (std::size_t i = 0; i < std::size(to); ++i)
+      {
+        index[target_hash<dir>(to[i])].targets.push_back(i);
+      }
+
+      auto plan    = reconcile_plan{};
+      auto matched = std::vector<bool>(std::size(to), false);
+      for (std::size_t i = 0; i < std::size(from); ++i)
+      {
+        auto found = std::optional<std::size_t>{};
+        if (auto entry = index.find(source_hash<dir>(from[i])); entry != index.end())
+        {
+          found = entry->second.match(matched,
+                                      [this, &to, &from, i](std::size_t j)
+                                      {
+                                        return key_equal<dir>(to[j], from[i]);
+                                      });
+        }
+        if (!found)
+        {
+          plan.inserts.push_back(i);
+          continue;
+        }
+
+        auto const j = *found;
+        if (!records_equal<dir>(to[j], from[i]))
+        {
+          plan.updates.emplace_back(j, i);
+        }
+      }
+
+      for (std::size_t j = 0; j < matched.size(); ++j)
+      {
+        if (!matched[j])
+        {
+          plan.erases.push_back(j);
+        }
+      }
+      return plan;
+    }
+
+    // Applies 'plan' (as returned by 'plan' for the same collections) to the 'dir' target.
+    template<direction dir = direction::rhs_to_lhs>
+    void
+    apply(reconcile_plan const& plan, auto&& lhs, auto&& rhs) const
+      requires concepts::reconcilable_container<traits::lhs_t<dir, decltype(lhs), decltype(rhs)>>
+    {
+      auto&& [to, from] = operators::details::ordered_lhs_rhs<dir>(lhs, rhs);
+
+      // updates & erases refer to the indices before anything is inserted or erased
+      for (auto const& [j, i] : plan.updates)
+      {
+        assign_record<dir>(to[j], from[i]);
+      }
+      if (!plan.erases.empty())
+      {
+        auto next = plan.erases.begin();
+        auto kept = std::size_t{0};
+        for (std::size_t j = 0; j < std::size(to); ++j)
+        {
+          if (next != plan.erases.end() && *next == j)
+          {
+            ++next;
+          }
+          else
+          {
+            if (kept != j)
+            {
+              to[kept] = std::move(to[j]);
+            }
+            ++kept;
+          }
+        }
+        to.erase(std::next(std::begin(to), static_cast<std::ptrdiff_t>(kept)), std::end(to));
+      }
+      for (auto const i : plan.inserts)
+      {
+        assign_record<dir>(to.emplace_back(), from[i]);
+      }
+    }
+
+    // Makes the 'dir' target equal to its source, returning the changes made.
+    template<direction dir = direction::rhs_to_lhs>
+    auto
+    assign(auto&& lhs, auto&& rhs) const -> reconcile_plan
+      requires requires (reconciler const& self) {
+                 self.template plan<dir>(lhs, rhs);
+                 self.template apply<dir>(reconcile_plan{}, lhs, rhs);
+               }
+    {
+      auto plan = this->template plan<dir>(lhs, rhs);
+      apply<dir>(plan, lhs, rhs);
+      return plan;
+    }
+
+  private:
+    // Target records sharing a key hash (in their order), from the first one not matched yet.
+    struct index_entry
+    {
+      std::vector<std::size_t> targets;
+      std::size_t              cursor = 0;
+
+      // Marks the first unmatched target accepted by 'matches' as matched & returns it. Duplicate
+      // keys are thus matched in order, in constant time unless their hashes collide.
+      auto
+      match(std::vector<bool>& matched, auto const& matches) -> std::optional<std::size_t>
+      {
+        while (cursor < targets.size() && matched[targets[cursor]])
+        {
+          ++cursor;
+        }
+        for (auto k = cursor; k < targets.size(); ++k)
+        {
+          auto const j = targets[k];
+          if (!matched[j] && matches(j))
+          {
+            matched[j] = true;
+            return j;
+          }
+        }
+        return std::nullopt;
+      }
+    };
+
+    template<direction dir>
+    auto
+    target_hash(auto const& target) const -> std::size_t
+    {
+      if constexpr (dir == direction::rhs_to_lhs)
+      {
+        return key_.hash_lhs(target);
+      }
+      else
+      {
+        return key_.hash_rhs(target);
+      }
+    }
+
+    template<direction dir>
+    auto
+    source_hash(auto const& source) const -> std::size_t
+    {
+      if constexpr (dir == direction::rhs_to_lhs)
+      {
+        return key_.hash_rhs(source);
+      }
+      else
+      {
+        return key_.hash_lhs(source);
+      }
+    }
+
+    template<direction dir>
+    auto
+    key_equal(auto const& target, auto const& source) const -> bool
+    {
+      auto const& [lhs, rhs] = operators::details::ordered_lhs_rhs<dir>(target, source);
+      return key_.equal(lhs, rhs);
+    }
+
+    template<direction dir>
+    auto
+    records_equal(auto const& target, auto const& source) const -> bool
+    {
+      auto const& [lhs, rhs] = operators::details::ordered_lhs_rhs<dir>(target, source);
+      return table_.template equal<dir>(lhs, rhs);
+    }
+
+    template<direction dir>
+    void
+    assign_record(auto& target, auto const& source) const
+    {
+      auto&& [lhs, rhs] = operators::details::ordered_lhs_rhs<dir>(target, source);
+      table_.template assign<dir>(lhs, rhs);
+    }
+
+    table_t table_;
+    key_t   key_;
+  };
+}
@@ -0,0 +1,580 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #define CONVERTIBLE_SIMD_X86_64
+  #include <immintrin.h>
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+  #endif
+#endif
+
+// GCC & clang only emit AVX2 instructions for functions explicitly targeting it (unless the whole
+// TU is compiled with '-mavx2'), MSVC emits whatever intrinsic is used.
+#if defined(__GNUC__) || defined(__clang__)
+  #define CONVERTIBLE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+  #define CONVERTIBLE_TARGET_AVX2
+#endif
+
+namespace convertible::simd
+{
+  // Instruction set used by the conversion kernels, ordered from least to most capable.
+  enum class isa
+  {
+    scalar,
+    sse2,
+    avx2
+  };
+
+  namespace details
+  {
+    enum class numeric_kind
+    {
+      none,
+      i16,
+      i32,
+      i64,
+      f32,
+      f64
+    };
+
+    // Kernels operate on the representation, so eg. 'long' & 'long long' share the 'i64' kernels.
+    // Unsigned integers are left out since SSE2/AVX2 lack the matching conversion instructions.
+    template<typename T>
+    constexpr auto
+    kind_of() -> numeric_kind
+    {
+      if constexpr (std::is_floating_point_v<T> && sizeof(T) == 4)
+      {
+        return numeric_kind::f32;
+      }
+      else if constexpr (std::is_floating_point_v<T> && sizeof(T) == 8)
+      {
+        return numeric_kind::f64;
+      }
+      else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> &&
+                         !std::is_same_v<T, char> && !std::is_same_v<T, wchar_t>)
+      {
+        switch (sizeof(T))
+        {
+          case 2:
+            return numeric_kind::i16;
+          case 4:
+            return numeric_kind::i32;
+          case 8:
+            return numeric_kind::i64;
+          default:
+            return numeric_kind::none;
+        }
+      }
+      else
+      {
+        return numeric_kind::none;
+      }
+    }
+
+    template<typename T>
+    constexpr numeric_kind kind_v = kind_of<std::remove_cv_t<T>>();
+
+    // Each specialization converts as many leading elements as fits its vector width & returns the
+    // count, leaving the tail to the scalar loop in 'convert'.
+    template<numeric_kind from, numeric_kind to>
+    struct kernel
+    {
+      static constexpr bool available = false;
+    };
+
+#ifdef CONVERTIBLE_SIMD_X86_64
+    inline auto
+    detect_isa() -> isa
+    {
+  #if defined(__GNUC__) || defined(__clang__)
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") ? isa::avx2 : isa::sse2;
+  #else
+      int info[4] = {}; // NOLINT
+      __cpuid(info, 0);
+      if (info[0] < 7)
+      {
+        return isa::sse2;
+      }
+      __cpuid(info, 1);
+      bool const osxsave = (info[2] & (1 << 27)) != 0;
+      bool const avx     = (info[2] & (1 << 28)) != 0;
+      if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+      {
+        return isa::sse2;
+      }
+      __cpuidex(info, 7, 0);
+      return (info[1] & (1 << 5)) != 0 ? isa::avx2 : isa::sse2;
+  #endif
+    }
+
+    template<>
+    struct kernel<numeric_kind::i32, numeric_kind::f32>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<float*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          _mm_storeu_ps(out + i, _mm_cvtepi32_ps(v));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<float*>(dst);
+        std::size_t i   = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+          _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(v));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::f32, numeric_kind::i32>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<float const*>(src);
+        auto*       out = static_cast<std::int32_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                           _mm_cvttps_epi32(_mm_loadu_ps(in + i)));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<float const*>(src);
+        auto*       out = static_cast<std::int32_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                              _mm256_cvttps_epi32(_mm256_loadu_ps(in + i)));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::i32, numeric_kind::f64>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<double*>(dst);
+        std::size_t i   = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+          __m128i v = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i));
+          _mm_storeu_pd(out + i, _mm_cvtepi32_pd(v));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<double*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          _mm256_storeu_pd(out + i, _mm256_cvtepi32_pd(v));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::f64, numeric_kind::i32>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<double const*>(src);
+        auto*       out = static_cast<std::int32_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                           _mm_cvttpd_epi32(_mm_loadu_pd(in + i)));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<double const*>(src);
+        auto*       out = static_cast<std::int32_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                           _mm256_cvttpd_epi32(_mm256_loadu_pd(in + i)));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::f32, numeric_kind::f64>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<float const*>(src);
+        auto*       out = static_cast<double*>(dst);
+        std::size_t i   = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+          __m128 v = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i)));
+          _mm_storeu_pd(out + i, _mm_cvtps_pd(v));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<float const*>(src);
+        auto*       out = static_cast<double*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_loadu_ps(in + i)));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::f64, numeric_kind::f32>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<double const*>(src);
+        auto*       out = static_cast<float*>(dst);
+        std::size_t i   = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+          __m128 v = _mm_cvtpd_ps(_mm_loadu_pd(in + i));
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_castps_si128(v));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<double const*>(src);
+        auto*       out = static_cast<float*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          _mm_storeu_ps(out + i, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i)));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::i16, numeric_kind::i32>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int16_t const*>(src);
+        auto*       out = static_cast<std::int32_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          // duplicate each 16-bit value into a 32-bit lane & shift it back down to sign-extend
+          __m128i v  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+          __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), lo);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), hi);
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int16_t const*>(src);
+        auto*       out = static_cast<std::int32_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvtepi16_epi32(v));
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::i32, numeric_kind::i16>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<std::int16_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          // sign-extend the low 16 bits first so the saturating pack truncates (like static_cast)
+          __m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          __m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i + 4));
+          a         = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+          b         = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(a, b));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<std::int16_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+          __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+          __m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i + 8));
+          a         = _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16);
+          b         = _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16);
+          // packing is done per 128-bit lane, so restore element order afterwards
+          __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+        }
+        return i;
+      }
+    };
+
+    template<>
+    struct kernel<numeric_kind::i32, numeric_kind::i64>
+    {
+      static constexpr bool available = true;
+
+      static auto
+      sse2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<std::int64_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          __m128i v    = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          __m128i sign = _mm_srai_epi32(v, 31);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi32(v, sign));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 2), _mm_unpackhi_epi32(v, sign));
+        }
+        return i;
+      }
+
+      CONVERTIBLE_TARGET_AVX2 static auto
+      avx2(void const* src, void* dst, std::size_t n) -> std::size_t
+      {
+        auto const* in  = static_cast<std::int32_t const*>(src);
+        auto*       out = static_cast<std::int64_t*>(dst);
+        std::size_t i   = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_cvtepi32_epi64(v));
+        }
+        return i;
+      }
+    };
+#else
+    inline auto
+    detect_isa() -> isa
+    {
+      return isa::scalar;
+    }
+#endif
+  }
+
+  // Most capable instruction set of the running CPU (detected once).
+  inline auto
+  supported_isa() -> isa
+  {
+    static isa const level = details::detect_isa();
+    return level;
+  }
+
+  // A vectorized kernel exists for converting 'from_t' into 'to_t' (see 'convert').
+  template<typename from_t, typename to_t>
+  concept vectorizable =
+    details::kernel<details::kind_v<from_t>, details::kind_v<to_t>>::available;
+
+  // Equivalent of 'dst[i] = static_cast<to_t>(src[i])' for 'i' in '[0, count)', using the given
+  // instruction set (capped to what is supported) for the bulk & a scalar loop for the tail.
+  template<typename from_t, typename to_t>
+    requires vectorizable<from_t, to_t>
+  inline void
+  convert(from_t const* src, to_t* dst, std::size_t count, isa level = supported_isa())
+  {
+    if (level > supported_isa())
+    {
+      level = supported_isa();
+    }
+
+    std::size_t done = 0;
+#ifdef CONVERTIBLE_SIMD_X86_64
+    using kernel_t = details::kernel<details::kind_v<from_t>, details::kind_v<to_t>>;
+    if (level == isa::avx2)
+    {
+      done = kernel_t::avx2(src, dst, count);
+    }
+    else if (level == isa::sse2)
+    {
+      done = kernel_t::sse2(src, dst, count);
+    }
+#endif
+    for (; done < count; ++done)
+    {
+      dst[done] = static_cast<to_t>(src[done]);
+    }
+  }
+
+  namespace details
+  {
+    template<typename lhs_t, typename rhs_t>
+    using common_t = std::common_type_t<std::remove_cv_t<lhs_t>, std::remove_cv_t<rhs_t>>;
+
+    template<typename from_t, typename to_t>
+    constexpr bool widenable_v = std::is_same_v<std::remove_cv_t<from_t>, to_t> ||
+                                 kind_v<from_t> == kind_v<to_t> ||
+                                 kernel<kind_v<from_t>, kind_v<to_t>>::available;
+
+    // Returns 'src' as-is if already of type 'to_t', else converts it into 'buffer'.
+    template<typename from_t, typename to_t>
+    inline auto
+    widen(from_t const* src, to_t* buffer, std::size_t count, isa level) -> to_t const*
+    {
+      if constexpr (std::is_same_v<std::remove_cv_t<from_t>, to_t>)
+      {
+        (void)buffer;
+        (void)count;
+        (void)level;
+        return src;
+      }
+      else if constexpr (kernel<kind_v<from_t>, kind_v<to_t>>::available)
+      {
+        convert(src, buffer, count, level);
+        return buffer;
+      }
+      else
+      {
+        (void)level;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          buffer[i] = static_cast<to_t>(src[i]);
+        }
+        return buffer;
+      }
+    }
+  }
+
+  // Both types can be widened to their common type with a vectorized kernel (or are already of
+  // that type), see 'equal'.
+  template<typename lhs_t, typename rhs_t>
+  concept comparable = details::kind_v<lhs_t> != details::numeric_kind::none &&
+                       details::kind_v<rhs_t> != details::numeric_kind::none &&
+                       details::widenable_v<lhs_t, details::common_t<lhs_t, rhs_t>> &&
+                       details::widenable_v<rhs_t, details::common_t<lhs_t, rhs_t>>;
+
+  // Equivalent of 'lhs[i] == rhs[i]' for all 'i' in '[0, count)' (ie. compared as their common
+  // type), processed in chunks that are widened with the conversion kernels. Returns as soon as a
+  // chunk contains a mismatch.
+  template<typename lhs_t, typename rhs_t>
+    requires comparable<lhs_t, rhs_t>
+  inline auto
+  equal(lhs_t const* lhs, rhs_t const* rhs, std::size_t count, isa level = supported_isa())
+    -> bool
+  {
+    using common_t = details::common_t<lhs_t, rhs_t>;
+
+    constexpr std::size_t chunk_size = 256;
+    common_t              lhs_buffer[chunk_size]; // NOLINT
+    common_t              rhs_buffer[chunk_size]; // NOLINT
+
+    for (std::size_t offset = 0; offset < count; offset += chunk_size)
+    {
+      auto const  size = std::min(chunk_size, count - offset);
+      auto const* l    = details::widen(lhs + offset, lhs_buffer, size, level);
+      auto const* r    = details::widen(rhs + offset, rhs_buffer, size, level);
+
+      if constexpr (std::is_integral_v<common_t>)
+      {
+        if (std::memcmp(l, r, size * sizeof(common_t)) != 0)
+        {
+          return false;
+        }
+      }
+      else
+      {
+        // branchless within the chunk so the loop vectorizes
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+          mismatches += !(l[i] == r[i]);
+        }
+        if (mismatches != 0)
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+}
@@ -75,6 +75,13 @@ namespace convertible
     template<typename obj_t>
     concept trivially_copyable = std::is_trivially_copyable_v<std::remove_reference_t<obj_t>>;
 
+    // Equality is equivalent to comparing object representations (eg. with memcmp). Excludes
+    // floating point types (+0 == -0, NaN != NaN) & class types (may define their own equality).
+    template<typename obj_t>
+    concept bitwise_comparable = (std::is_integral_v<std::remove_cvref_t<obj_t>> ||
+                                  std::is_pointer_v<std::remove_cvref_t<obj_t>>) &&
+                                 std::has_unique_object_representations_v<std::remove_cvref_t<obj_t>>;
+
     template<typename from_t, typename to_t>
     concept castable_to = requires { static_cast<to_t>(std::declval<from_t>()); };
 
@@ -107,6 +114,15 @@ namespace convertible
     concept resizable_container =
       range<cont_t> && requires (std::remove_reference_t<cont_t> c) { c.resize(std::size_t{0}); };
 
+    // Elements are stored contiguously & reachable through a raw pointer (eg. C arrays,
+    // std::array, std::vector, std::string).
+    template<typename cont_t>
+    concept contiguous_container = range<cont_t> &&
+                                   requires (std::remove_reference_t<cont_t>& c) {
+                                     std::size(c);
+                                     requires std::is_pointer_v<decltype(std::data(c))>;
+                                   };
+
     // Very rudimental concept based on "Member Function Table" here:
     // https://en.cppreference.com/w/cpp/container
     template<typename cont_t>